@@ -2501,7 +2501,7 @@ matrix_type :: proc() {
 	// Padding between columns was not taken even if that would have allowed each column to be loaded
 	// individually into a SIMD register with the correct alignment properties.
 	//
-	// Currently, matrices are limited to a maximum of 16 elements (rows*columns), and a minimum of 1 element.
+	// Currently, matrices are limited to a maximum of 64 elements (rows*columns), and a minimum of 1 element.
 	// This is because matrices are stored as values (not a reference type), and thus operations on them will
 	// be stored on the stack. Restricting the maximum element count minimizing the possibility of stack overflows.
 
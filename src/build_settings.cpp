@@ -514,6 +514,7 @@ struct BuildContext {
 
 	bool internal_no_inline;
 	bool internal_by_value;
+	bool internal_stream_tokens;
 
 	bool   no_threaded_checker;
 
@@ -342,7 +342,7 @@ gb_internal bool try_cached_build(Checker *c, Array<String> const &args) {
 			}
 
 			u64 timestamp = exact_value_to_u64(exact_value_integer_from_string(timestamp_str));
-			gbFileTime last_write_time = gb_file_last_write_time(alloc_cstring(temporary_allocator(), path_str));
+			gbFileTime last_write_time = file_last_write_time_cached(path_str);
 			if (last_write_time != timestamp) {
 				return false;
 			}
@@ -437,7 +437,7 @@ void write_cached_build(Checker *c, Array<String> const &args) {
 		gb_file_open_mode(&f, gbFileMode_Write, path_c);
 
 		for (String const &path : files) {
-			gbFileTime ft = gb_file_last_write_time(alloc_cstring(temporary_allocator(), path));
+			gbFileTime ft = file_last_write_time_cached(path);
 			gb_fprintf(&f, "%llu %.*s\n", cast(unsigned long long)ft, LIT(path));
 		}
 	}
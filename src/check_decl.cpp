@@ -929,8 +929,8 @@ gb_internal Entity *init_entity_foreign_library(CheckerContext *ctx, Entity *e)
 		foreign_library = &e->Procedure.foreign_library;
 		break;
 	case Entity_Variable:
-		ident = e->Variable.foreign_library_ident;
-		foreign_library = &e->Variable.foreign_library;
+		ident = entity_cold(e)->foreign_library_ident;
+		foreign_library = &entity_make_cold(e)->foreign_library;
 		break;
 	default:
 		return nullptr;
@@ -1387,8 +1387,11 @@ gb_internal void check_proc_decl(CheckerContext *ctx, Entity *e, DeclInfo *d) {
 	e->Procedure.no_sanitize_address = ac.no_sanitize_address;
 	e->Procedure.no_sanitize_memory  = ac.no_sanitize_memory;
 
-	e->deprecated_message = ac.deprecated_message;
-	e->warning_message = ac.warning_message;
+	if (ac.deprecated_message.len > 0 || ac.warning_message.len > 0) {
+		EntityCold *cold = entity_make_cold(e);
+		cold->deprecated_message = ac.deprecated_message;
+		cold->warning_message = ac.warning_message;
+	}
 	ac.link_name = handle_link_name(ctx, e->token, ac.link_name, ac.link_prefix, ac.link_suffix);
 	if (ac.has_disabled_proc) {
 		if (ac.disabled_proc) {
@@ -1569,7 +1572,7 @@ gb_internal void check_global_variable_decl(CheckerContext *ctx, Entity *&e, Ast
 	}
 	e->flags |= EntityFlag_Visited;
 
-	AttributeContext ac = make_attribute_context(e->Variable.link_prefix, e->Variable.link_suffix);
+	AttributeContext ac = make_attribute_context(entity_cold(e)->link_prefix, entity_cold(e)->link_suffix);
 	ac.init_expr_list_count = init_expr != nullptr ? 1 : 0;
 
 	DeclInfo *decl = decl_info_of_entity(e);
@@ -1584,7 +1587,6 @@ gb_internal void check_global_variable_decl(CheckerContext *ctx, Entity *&e, Ast
 	}
 
 
-	e->Variable.thread_local_model = ac.thread_local_model;
 	e->Variable.is_export = ac.is_export;
 	e->flags &= ~EntityFlag_Static;
 	if (ac.is_static) {
@@ -1595,13 +1597,16 @@ gb_internal void check_global_variable_decl(CheckerContext *ctx, Entity *&e, Ast
 	}
 	ac.link_name = handle_link_name(ctx, e->token, ac.link_name, ac.link_prefix, ac.link_suffix);
 
-	if (is_arch_wasm() && e->Variable.thread_local_model.len != 0) {
-		e->Variable.thread_local_model.len = 0;
+	if (is_arch_wasm() && ac.thread_local_model.len != 0) {
+		ac.thread_local_model.len = 0;
 		// NOTE(bill): ignore this message for the time being
 		// error(e->token, "@(thread_local) is not supported for this target platform");
 	}
 	if(build_context.no_thread_local) {
-		e->Variable.thread_local_model.len = 0;
+		ac.thread_local_model.len = 0;
+	}
+	if (ac.thread_local_model.len != 0) {
+		entity_make_cold(e)->thread_local_model = ac.thread_local_model;
 	}
 
 	String context_name = str_lit("variable declaration");
@@ -1629,21 +1634,21 @@ gb_internal void check_global_variable_decl(CheckerContext *ctx, Entity *&e, Ast
 			error(e->token, "A foreign variable declaration cannot have a default value");
 		}
 		init_entity_foreign_library(ctx, e);
-		if (is_arch_wasm() && e->Variable.foreign_library != nullptr) {
+		if (is_arch_wasm() && entity_cold(e)->foreign_library != nullptr) {
 			error(e->token, "A foreign variable declaration can not be scoped to a module and must be declared in a 'foreign {' (without a library) block");
 		}
 	}
 	if (ac.link_name.len > 0) {
-		e->Variable.link_name = ac.link_name;
+		entity_make_cold(e)->link_name = ac.link_name;
 	}
 	if (ac.link_section.len > 0) {
-		e->Variable.link_section = ac.link_section;
+		entity_make_cold(e)->link_section = ac.link_section;
 	}
 
 	if (e->Variable.is_foreign || e->Variable.is_export) {
 		String name = e->token.string;
-		if (e->Variable.link_name.len > 0) {
-			name = e->Variable.link_name;
+		if (entity_cold(e)->link_name.len > 0) {
+			name = entity_cold(e)->link_name;
 		}
 
 		auto *fp = &ctx->info->foreigns;
@@ -1665,7 +1670,7 @@ gb_internal void check_global_variable_decl(CheckerContext *ctx, Entity *&e, Ast
 		}
 	}
 	
-	if (e->Variable.link_name.len > 0) {
+	if (entity_cold(e)->link_name.len > 0) {
 		e->flags |= EntityFlag_CustomLinkName;
 	}
 
@@ -2096,6 +2101,7 @@ gb_internal bool check_proc_body(CheckerContext *ctx_, Token token, DeclInfo *de
 			}
 		}
 
+		check_zero_init_of_locals(body);
 	}
 	check_close_scope(ctx);
 
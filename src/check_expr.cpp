@@ -88,6 +88,7 @@ gb_internal bool     check_is_terminating           (Ast *node, String const &la
 gb_internal bool     check_has_break                (Ast *stmt, String const &label, bool implicit);
 gb_internal void     check_stmt                     (CheckerContext *c, Ast *node, u32 flags);
 gb_internal void     check_stmt_list                (CheckerContext *c, Slice<Ast *> const &stmts, u32 flags);
+gb_internal void     check_zero_init_of_locals      (Ast *body);
 gb_internal void     check_init_constant            (CheckerContext *c, Entity *e, Operand *operand);
 gb_internal bool     check_representable_as_constant(CheckerContext *c, ExactValue in_value, Type *type, ExactValue *out_value);
 gb_internal bool     check_procedure_type           (CheckerContext *c, Type *type, Ast *proc_type_node, Array<Operand> const *operands = nullptr);
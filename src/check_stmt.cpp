@@ -2074,7 +2074,7 @@ gb_internal void check_value_decl_stmt(CheckerContext *ctx, Ast *node, u32 mod_f
 				if (fl != nullptr) {
 					GB_ASSERT(fl->kind == Ast_Ident);
 					entity->Variable.is_foreign = true;
-					entity->Variable.foreign_library_ident = fl;
+					entity_make_cold(entity)->foreign_library_ident = fl;
 				}
 			} else {
 				TokenPos pos = found->token.pos;
@@ -2159,7 +2159,7 @@ gb_internal void check_value_decl_stmt(CheckerContext *ctx, Ast *node, u32 mod_f
 		ac.link_name = handle_link_name(ctx, e->token, ac.link_name, ac.link_prefix, ac.link_suffix);
 
 		if (ac.link_name.len > 0) {
-			e->Variable.link_name = ac.link_name;
+			entity_make_cold(e)->link_name = ac.link_name;
 		}
 
 		e->flags &= ~EntityFlag_Static;
@@ -2191,7 +2191,7 @@ gb_internal void check_value_decl_stmt(CheckerContext *ctx, Ast *node, u32 mod_f
 					error(e->token, "'thread_local' variables cannot be declared within a defer statement");
 				}
 			}
-			e->Variable.thread_local_model = ac.thread_local_model;
+			entity_make_cold(e)->thread_local_model = ac.thread_local_model;
 		}
 
 		if (ac.is_static && ac.thread_local_model != "") {
@@ -2218,8 +2218,8 @@ gb_internal void check_value_decl_stmt(CheckerContext *ctx, Ast *node, u32 mod_f
 			}
 
 			String name = e->token.string;
-			if (e->Variable.link_name.len > 0) {
-				name = e->Variable.link_name;
+			if (entity_cold(e)->link_name.len > 0) {
+				name = entity_cold(e)->link_name;
 			}
 
 			if (vd->values.count > 0) {
@@ -2257,6 +2257,11 @@ gb_internal void check_value_decl_stmt(CheckerContext *ctx, Ast *node, u32 mod_f
 			}
 		}
 		add_entity(ctx, ctx->scope, e->identifier, e);
+
+		if (vd->values.count == 0 && vd->is_using == 0 && e->kind == Entity_Variable &&
+		    (e->flags & EntityFlag_Static) == 0 && !e->Variable.is_foreign && !is_blank_ident(e->token)) {
+			e->Variable.zero_init = VariableZeroInit_Pending;
+		}
 	}
 
 	if (vd->is_using != 0) {
@@ -2959,3 +2964,538 @@ gb_internal void check_stmt_internal(CheckerContext *ctx, Ast *node, u32 flags)
 	case_end;
 	}
 }
+
+
+// NOTE: The locals declared without a value which may still be unassigned along a path
+struct ZeroInitFlow {
+	Array<Entity *> unassigned;
+	bool            unreachable;
+};
+
+// NOTE: A statement which a `break` may leave, with the flows of every such `break` joined
+struct ZeroInitTarget {
+	String       label;
+	bool         is_breakable; // i.e. left by an unlabelled `break`
+	ZeroInitFlow exit;
+};
+
+struct ZeroInitScan {
+	Array<Entity *>       locals;
+	Array<ZeroInitTarget> targets;
+	i32                   defer_depth;
+	i32                   constant_depth;
+};
+
+gb_internal ZeroInitFlow zero_init_flow_clone(ZeroInitFlow const &flow) {
+	ZeroInitFlow clone = flow;
+	clone.unassigned = array_clone(temporary_allocator(), flow.unassigned);
+	return clone;
+}
+
+gb_internal bool zero_init_is_unassigned(ZeroInitFlow *flow, Entity *e) {
+	for (Entity *u : flow->unassigned) {
+		if (u == e) {
+			return true;
+		}
+	}
+	return false;
+}
+
+gb_internal void zero_init_set_unassigned(ZeroInitFlow *flow, Entity *e) {
+	if (!zero_init_is_unassigned(flow, e)) {
+		array_add(&flow->unassigned, e);
+	}
+}
+
+gb_internal void zero_init_set_assigned(ZeroInitFlow *flow, Entity *e) {
+	for (isize i = 0; i < flow->unassigned.count; i++) {
+		if (flow->unassigned[i] == e) {
+			array_unordered_remove(&flow->unassigned, i);
+			return;
+		}
+	}
+}
+
+gb_internal void zero_init_set_unreachable(ZeroInitFlow *flow) {
+	array_clear(&flow->unassigned);
+	flow->unreachable = true;
+}
+
+// NOTE: A local is unassigned where two paths meet if it is unassigned along either of them
+gb_internal void zero_init_flow_join(ZeroInitFlow *dst, ZeroInitFlow const &src) {
+	if (src.unreachable) {
+		return;
+	}
+	if (dst->unreachable) {
+		*dst = zero_init_flow_clone(src);
+		return;
+	}
+	for (Entity *e : src.unassigned) {
+		zero_init_set_unassigned(dst, e);
+	}
+}
+
+gb_internal String zero_init_label_name(Ast *label) {
+	if (label != nullptr && label->kind == Ast_Label && label->Label.name->kind == Ast_Ident) {
+		return label->Label.name->Ident.token.string;
+	}
+	return {};
+}
+
+gb_internal isize zero_init_push_target(ZeroInitScan *scan, Ast *label, bool is_breakable) {
+	ZeroInitTarget target = {};
+	target.label = zero_init_label_name(label);
+	target.is_breakable = is_breakable;
+	target.exit.unassigned = array_make<Entity *>(temporary_allocator());
+	target.exit.unreachable = true;
+	array_add(&scan->targets, target);
+	return scan->targets.count-1;
+}
+
+gb_internal ZeroInitFlow zero_init_pop_target(ZeroInitScan *scan, isize index) {
+	GB_ASSERT(index == scan->targets.count-1);
+	return array_pop(&scan->targets).exit;
+}
+
+gb_internal void zero_init_break(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *label) {
+	String name = {};
+	if (label != nullptr && label->kind == Ast_Ident) {
+		name = label->Ident.token.string;
+	}
+	for (isize i = scan->targets.count-1; i >= 0; i--) {
+		ZeroInitTarget *target = &scan->targets[i];
+		if (name.len != 0 ? target->label == name : target->is_breakable) {
+			zero_init_flow_join(&target->exit, *flow);
+			return;
+		}
+	}
+	// NOTE: Unknown target, so nothing unassigned here may be relied upon afterwards
+	for (Entity *e : flow->unassigned) {
+		e->Variable.zero_init = VariableZeroInit_Required;
+	}
+}
+
+gb_internal Entity *zero_init_local_of(Ast *expr) {
+	expr = unparen_expr(expr);
+	if (expr == nullptr || expr->kind != Ast_Ident) {
+		return nullptr;
+	}
+	Entity *e = expr->Ident.entity;
+	if (e != nullptr && e->kind == Entity_Variable && e->Variable.zero_init == VariableZeroInit_Pending) {
+		return e;
+	}
+	return nullptr;
+}
+
+gb_internal void zero_init_use(ZeroInitScan *scan, ZeroInitFlow *flow, Entity *e) {
+	e->Variable.zero_init_uses -= 1;
+	if (scan->constant_depth > 0) {
+		return;
+	}
+	// NOTE: A deferred statement may also run from an earlier `return`, before the local is assigned
+	if (scan->defer_depth > 0 || zero_init_is_unassigned(flow, e)) {
+		e->Variable.zero_init = VariableZeroInit_Required;
+	}
+}
+
+gb_internal void zero_init_expr(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *expr);
+
+gb_internal void zero_init_expr_list(ZeroInitScan *scan, ZeroInitFlow *flow, Slice<Ast *> const &exprs) {
+	for (Ast *expr : exprs) {
+		zero_init_expr(scan, flow, expr);
+	}
+}
+
+// NOTE: Any reference to a local which is not yet assigned is a use of its zero value. Expressions not handled
+// here still leave their references unaccounted for, which keeps the zeroing of those locals.
+gb_internal void zero_init_expr(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *expr) {
+	expr = unparen_expr(expr);
+	if (expr == nullptr) {
+		return;
+	}
+
+	// NOTE: e.g. `len(buf)` or `size_of(buf)` do not read the local
+	AddressingMode mode = type_and_value_of_expr(expr).mode;
+	bool is_constant = mode == Addressing_Constant || mode == Addressing_Type;
+	scan->constant_depth += is_constant;
+	defer (scan->constant_depth -= is_constant);
+
+	switch (expr->kind) {
+	case Ast_Ident: {
+		Entity *e = zero_init_local_of(expr);
+		if (e != nullptr) {
+			zero_init_use(scan, flow, e);
+		}
+		break;
+	}
+
+	case Ast_UnaryExpr:
+		zero_init_expr(scan, flow, expr->UnaryExpr.expr);
+		break;
+	case Ast_BinaryExpr:
+		zero_init_expr(scan, flow, expr->BinaryExpr.left);
+		zero_init_expr(scan, flow, expr->BinaryExpr.right);
+		break;
+	case Ast_SelectorExpr:
+		zero_init_expr(scan, flow, expr->SelectorExpr.expr);
+		break;
+	case Ast_SelectorCallExpr:
+		zero_init_expr(scan, flow, expr->SelectorCallExpr.call);
+		break;
+	case Ast_IndexExpr:
+		zero_init_expr(scan, flow, expr->IndexExpr.expr);
+		zero_init_expr(scan, flow, expr->IndexExpr.index);
+		break;
+	case Ast_MatrixIndexExpr:
+		zero_init_expr(scan, flow, expr->MatrixIndexExpr.expr);
+		zero_init_expr(scan, flow, expr->MatrixIndexExpr.row_index);
+		zero_init_expr(scan, flow, expr->MatrixIndexExpr.column_index);
+		break;
+	case Ast_SliceExpr:
+		zero_init_expr(scan, flow, expr->SliceExpr.expr);
+		zero_init_expr(scan, flow, expr->SliceExpr.low);
+		zero_init_expr(scan, flow, expr->SliceExpr.high);
+		break;
+	case Ast_DerefExpr:
+		zero_init_expr(scan, flow, expr->DerefExpr.expr);
+		break;
+	case Ast_TernaryIfExpr:
+		zero_init_expr(scan, flow, expr->TernaryIfExpr.cond);
+		zero_init_expr(scan, flow, expr->TernaryIfExpr.x);
+		zero_init_expr(scan, flow, expr->TernaryIfExpr.y);
+		break;
+	case Ast_TernaryWhenExpr:
+		zero_init_expr(scan, flow, expr->TernaryWhenExpr.x);
+		zero_init_expr(scan, flow, expr->TernaryWhenExpr.y);
+		break;
+	case Ast_OrElseExpr:
+		zero_init_expr(scan, flow, expr->OrElseExpr.x);
+		zero_init_expr(scan, flow, expr->OrElseExpr.y);
+		break;
+	case Ast_OrReturnExpr:
+		zero_init_expr(scan, flow, expr->OrReturnExpr.expr);
+		break;
+	case Ast_OrBranchExpr:
+		zero_init_expr(scan, flow, expr->OrBranchExpr.expr);
+		if (expr->OrBranchExpr.token.kind == Token_break) {
+			zero_init_break(scan, flow, expr->OrBranchExpr.label);
+		}
+		break;
+	case Ast_TypeAssertion:
+		zero_init_expr(scan, flow, expr->TypeAssertion.expr);
+		break;
+	case Ast_TypeCast:
+		zero_init_expr(scan, flow, expr->TypeCast.expr);
+		break;
+	case Ast_AutoCast:
+		zero_init_expr(scan, flow, expr->AutoCast.expr);
+		break;
+	case Ast_FieldValue:
+		zero_init_expr(scan, flow, expr->FieldValue.field);
+		zero_init_expr(scan, flow, expr->FieldValue.value);
+		break;
+	case Ast_CompoundLit:
+		zero_init_expr_list(scan, flow, expr->CompoundLit.elems);
+		break;
+	case Ast_CallExpr:
+		zero_init_expr(scan, flow, expr->CallExpr.proc);
+		zero_init_expr_list(scan, flow, expr->CallExpr.args);
+		break;
+	}
+}
+
+// NOTE: The least number of elements the source of a `copy` is known to have, or -1
+gb_internal i64 zero_init_min_copy_len(Ast *src) {
+	src = unparen_expr(src);
+	TypeAndValue tav = type_and_value_of_expr(src);
+	if (tav.mode == Addressing_Constant && tav.value.kind == ExactValue_String) {
+		return tav.value.value_string.len;
+	}
+	if (src->kind != Ast_SliceExpr) {
+		return -1;
+	}
+	// NOTE: Slicing is bounds checked, so the slice has exactly as many elements as its bounds say
+	ast_node(se, SliceExpr, src);
+	i64 low = 0;
+	i64 high = -1;
+	if (se->low != nullptr) {
+		TypeAndValue low_tav = type_and_value_of_expr(se->low);
+		if (low_tav.mode != Addressing_Constant || low_tav.value.kind != ExactValue_Integer) {
+			return -1;
+		}
+		low = exact_value_to_i64(low_tav.value);
+	}
+	if (se->high != nullptr) {
+		TypeAndValue high_tav = type_and_value_of_expr(se->high);
+		if (high_tav.mode != Addressing_Constant || high_tav.value.kind != ExactValue_Integer) {
+			return -1;
+		}
+		high = exact_value_to_i64(high_tav.value);
+	} else {
+		Type *t = base_type(type_deref(type_of_expr(se->expr)));
+		if (t == nullptr || t->kind != Type_Array) {
+			return -1;
+		}
+		high = t->Array.count;
+	}
+	return high >= low ? high - low : -1;
+}
+
+// NOTE: The local wholly overwritten by a call, i.e. a `copy` into all of a fixed array from a source at least as
+// long, or a `mem_copy` to its address of at least its size. `*dst_` is set to the argument naming the local.
+gb_internal Entity *zero_init_copied_local(Ast *expr, Ast **dst_) {
+	expr = unparen_expr(expr);
+	if (expr->kind != Ast_CallExpr) {
+		return nullptr;
+	}
+	ast_node(ce, CallExpr, expr);
+	Entity *proc = entity_of_node(ce->proc);
+	if (proc == nullptr) {
+		return nullptr;
+	}
+	bool is_copy = false;
+	bool is_mem_copy = false;
+	if (proc->kind == Entity_Builtin) {
+		BuiltinProcId id = cast(BuiltinProcId)proc->Builtin.id;
+		is_mem_copy = id == BuiltinProc_mem_copy || id == BuiltinProc_mem_copy_non_overlapping;
+	} else if (proc->kind == Entity_Procedure && proc->pkg != nullptr && proc->pkg->kind == Package_Runtime) {
+		String name = proc->token.string;
+		is_copy = name == "copy_slice" || name == "copy_from_string";
+		is_mem_copy = name == "mem_copy" || name == "mem_copy_non_overlapping";
+	}
+
+	if (is_copy && ce->args.count == 2) {
+		Ast *dst = unparen_expr(ce->args[0]);
+		if (dst->kind != Ast_SliceExpr || dst->SliceExpr.low != nullptr || dst->SliceExpr.high != nullptr) {
+			return nullptr;
+		}
+		Entity *e = zero_init_local_of(dst->SliceExpr.expr);
+		Type *t = e != nullptr ? base_type(e->type) : nullptr;
+		if (t == nullptr || t->kind != Type_Array || zero_init_min_copy_len(ce->args[1]) < t->Array.count) {
+			return nullptr;
+		}
+		*dst_ = dst->SliceExpr.expr;
+		return e;
+	}
+	if (is_mem_copy && ce->args.count == 3) {
+		Ast *dst = unparen_expr(ce->args[0]);
+		if (dst->kind != Ast_UnaryExpr || dst->UnaryExpr.op.kind != Token_And) {
+			return nullptr;
+		}
+		Entity *e = zero_init_local_of(dst->UnaryExpr.expr);
+		TypeAndValue len = type_and_value_of_expr(ce->args[2]);
+		if (e == nullptr || len.mode != Addressing_Constant || len.value.kind != ExactValue_Integer ||
+		    exact_value_to_i64(len.value) < type_size_of(e->type)) {
+			return nullptr;
+		}
+		*dst_ = dst->UnaryExpr.expr;
+		return e;
+	}
+	return nullptr;
+}
+
+gb_internal void zero_init_stmt(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *stmt);
+
+gb_internal void zero_init_stmt_list(ZeroInitScan *scan, ZeroInitFlow *flow, Slice<Ast *> const &stmts) {
+	for (Ast *stmt : stmts) {
+		zero_init_stmt(scan, flow, stmt);
+	}
+}
+
+// NOTE: A loop body may run any number of times, including none. The locals unassigned on entry to the body are
+// a superset of those unassigned at the start of any later iteration, so one pass over it is enough.
+gb_internal void zero_init_loop_body(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *label, Ast *body, Ast *post) {
+	isize target = zero_init_push_target(scan, label, true);
+	ZeroInitFlow body_flow = zero_init_flow_clone(*flow);
+	zero_init_stmt(scan, &body_flow, body);
+	ZeroInitFlow post_flow = zero_init_flow_clone(*flow);
+	zero_init_stmt(scan, &post_flow, post);
+	zero_init_flow_join(flow, zero_init_pop_target(scan, target));
+}
+
+gb_internal void zero_init_switch_body(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *label, Ast *body) {
+	isize target = zero_init_push_target(scan, label, true);
+	ZeroInitFlow out = {};
+	out.unassigned = array_make<Entity *>(temporary_allocator());
+	out.unreachable = true;
+	bool has_default = false;
+	for (Ast *clause : body->BlockStmt.stmts) {
+		if (clause->kind != Ast_CaseClause) {
+			continue;
+		}
+		ast_node(cc, CaseClause, clause);
+		has_default |= cc->list.count == 0;
+		// NOTE: A `fallthrough` enters the next clause with fewer locals unassigned than on entry to the switch
+		ZeroInitFlow clause_flow = zero_init_flow_clone(*flow);
+		zero_init_expr_list(scan, &clause_flow, cc->list);
+		zero_init_stmt_list(scan, &clause_flow, cc->stmts);
+		zero_init_flow_join(&out, clause_flow);
+	}
+	if (!has_default) {
+		zero_init_flow_join(&out, *flow);
+	}
+	zero_init_flow_join(&out, zero_init_pop_target(scan, target));
+	*flow = out;
+}
+
+gb_internal void zero_init_stmt(ZeroInitScan *scan, ZeroInitFlow *flow, Ast *stmt) {
+	if (stmt == nullptr) {
+		return;
+	}
+	switch (stmt->kind) {
+	case_ast_node(es, ExprStmt, stmt);
+		Ast *dst = nullptr;
+		Entity *e = zero_init_copied_local(es->expr, &dst);
+		if (e == nullptr) {
+			zero_init_expr(scan, flow, es->expr);
+			break;
+		}
+		ast_node(ce, CallExpr, unparen_expr(es->expr));
+		zero_init_expr(scan, flow, ce->proc);
+		for (Ast *arg : ce->args) {
+			if (arg != ce->args[0]) {
+				zero_init_expr(scan, flow, arg);
+			}
+		}
+		e->Variable.zero_init_uses -= 1;
+		if (scan->defer_depth > 0) {
+			e->Variable.zero_init = VariableZeroInit_Required;
+		}
+		zero_init_set_assigned(flow, e);
+	case_end;
+
+	case_ast_node(as, AssignStmt, stmt);
+		zero_init_expr_list(scan, flow, as->rhs);
+		if (as->op.kind != Token_Eq) {
+			zero_init_expr_list(scan, flow, as->lhs);
+			break;
+		}
+		for (Ast *lhs : as->lhs) {
+			Entity *e = zero_init_local_of(lhs);
+			if (e == nullptr || scan->defer_depth > 0) {
+				zero_init_expr(scan, flow, lhs);
+				continue;
+			}
+			e->Variable.zero_init_uses -= 1;
+			zero_init_set_assigned(flow, e);
+		}
+	case_end;
+
+	case_ast_node(vd, ValueDecl, stmt);
+		if (!vd->is_mutable) {
+			break;
+		}
+		zero_init_expr_list(scan, flow, vd->values);
+		for (Ast *name : vd->names) {
+			Entity *e = zero_init_local_of(name);
+			if (e != nullptr) {
+				if (!zero_init_is_unassigned(flow, e)) {
+					array_add(&scan->locals, e);
+				}
+				zero_init_set_unassigned(flow, e);
+			}
+		}
+	case_end;
+
+	case_ast_node(bs, BlockStmt, stmt);
+		isize target = zero_init_push_target(scan, bs->label, false);
+		zero_init_stmt_list(scan, flow, bs->stmts);
+		zero_init_flow_join(flow, zero_init_pop_target(scan, target));
+	case_end;
+
+	case_ast_node(is, IfStmt, stmt);
+		isize target = zero_init_push_target(scan, is->label, false);
+		zero_init_stmt(scan, flow, is->init);
+		zero_init_expr(scan, flow, is->cond);
+		ZeroInitFlow else_flow = zero_init_flow_clone(*flow);
+		zero_init_stmt(scan, flow, is->body);
+		zero_init_stmt(scan, &else_flow, is->else_stmt);
+		zero_init_flow_join(flow, else_flow);
+		zero_init_flow_join(flow, zero_init_pop_target(scan, target));
+	case_end;
+
+	case_ast_node(ws, WhenStmt, stmt);
+		// NOTE: Only the statements of the branch taken have been checked
+		TypeAndValue tav = type_and_value_of_expr(ws->cond);
+		if (tav.mode != Addressing_Constant || tav.value.kind != ExactValue_Bool) {
+			break;
+		}
+		zero_init_stmt(scan, flow, tav.value.value_bool ? ws->body : ws->else_stmt);
+	case_end;
+
+	case_ast_node(fs, ForStmt, stmt);
+		zero_init_stmt(scan, flow, fs->init);
+		zero_init_expr(scan, flow, fs->cond);
+		zero_init_loop_body(scan, flow, fs->label, fs->body, fs->post);
+	case_end;
+
+	case_ast_node(rs, RangeStmt, stmt);
+		zero_init_expr(scan, flow, rs->expr);
+		zero_init_loop_body(scan, flow, rs->label, rs->body, nullptr);
+	case_end;
+
+	case_ast_node(rs, UnrollRangeStmt, stmt);
+		zero_init_expr(scan, flow, rs->expr);
+		zero_init_loop_body(scan, flow, nullptr, rs->body, nullptr);
+	case_end;
+
+	case_ast_node(ss, SwitchStmt, stmt);
+		zero_init_stmt(scan, flow, ss->init);
+		zero_init_expr(scan, flow, ss->tag);
+		zero_init_switch_body(scan, flow, ss->label, ss->body);
+	case_end;
+
+	case_ast_node(ss, TypeSwitchStmt, stmt);
+		if (ss->tag != nullptr && ss->tag->kind == Ast_AssignStmt) {
+			zero_init_expr_list(scan, flow, ss->tag->AssignStmt.rhs);
+		}
+		zero_init_switch_body(scan, flow, ss->label, ss->body);
+	case_end;
+
+	case_ast_node(ds, DeferStmt, stmt);
+		ZeroInitFlow defer_flow = zero_init_flow_clone(*flow);
+		scan->defer_depth += 1;
+		zero_init_stmt(scan, &defer_flow, ds->stmt);
+		scan->defer_depth -= 1;
+	case_end;
+
+	case_ast_node(rs, ReturnStmt, stmt);
+		zero_init_expr_list(scan, flow, rs->results);
+		zero_init_set_unreachable(flow);
+	case_end;
+
+	case_ast_node(bs, BranchStmt, stmt);
+		if (bs->token.kind == Token_break) {
+			zero_init_break(scan, flow, bs->label);
+		}
+		zero_init_set_unreachable(flow);
+	case_end;
+
+	case_ast_node(us, UsingStmt, stmt);
+		zero_init_expr_list(scan, flow, us->list);
+	case_end;
+	}
+}
+
+// NOTE: Elides the zeroing of each local declared without a value which is wholly assigned on every path before
+// any other use, i.e. a definite assignment analysis over the checked body of a procedure
+gb_internal void check_zero_init_of_locals(Ast *body) {
+	TEMPORARY_ALLOCATOR_GUARD();
+
+	ZeroInitScan scan = {};
+	scan.locals  = array_make<Entity *>(temporary_allocator());
+	scan.targets = array_make<ZeroInitTarget>(temporary_allocator());
+
+	ZeroInitFlow flow = {};
+	flow.unassigned = array_make<Entity *>(temporary_allocator());
+	zero_init_stmt(&scan, &flow, body);
+
+	for (Entity *e : scan.locals) {
+		// NOTE: Any use which the scan did not see may have read the zero value
+		if (e->Variable.zero_init == VariableZeroInit_Pending && e->Variable.zero_init_uses == 0) {
+			e->Variable.zero_init = VariableZeroInit_Elided;
+		} else {
+			e->Variable.zero_init = VariableZeroInit_Required;
+		}
+	}
+}
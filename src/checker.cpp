@@ -70,38 +70,27 @@ gb_internal void entity_graph_node_set_add(EntityGraphNodeSet *s, EntityGraphNod
 // 	return ptr_set_exists(s, n);
 // }
 
-gb_internal void entity_graph_node_set_remove(EntityGraphNodeSet *s, EntityGraphNode *n) {
-	ptr_set_remove(s, n);
-}
-
 gb_internal void entity_graph_node_destroy(EntityGraphNode *n, gbAllocator a) {
-	entity_graph_node_set_destroy(&n->pred);
+	slice_free(&n->pred, a);
 	entity_graph_node_set_destroy(&n->succ);
 	gb_free(a, n);
 }
 
 
-gb_internal int entity_graph_node_cmp(EntityGraphNode **data, isize i, isize j) {
-	EntityGraphNode *x = data[i];
-	EntityGraphNode *y = data[j];
-	u64 a = x->entity->order_in_src;
-	u64 b = y->entity->order_in_src;
-	if (x->dep_count < y->dep_count) {
-		return -1;
-	}
-	if (x->dep_count == y->dep_count) {
-		return a < b ? -1 : b > a;
-	}
-	return +1;
-}
+struct EntityGraphNodeRank {
+	u64              order_in_src;
+	isize            index; // Index in the graph, only to break ties
+	EntityGraphNode *node;
+};
 
-gb_internal void entity_graph_node_swap(EntityGraphNode **data, isize i, isize j) {
-	EntityGraphNode *x = data[i];
-	EntityGraphNode *y = data[j];
-	data[i] = y;
-	data[j] = x;
-	x->index = j;
-	y->index = i;
+gb_internal GB_COMPARE_PROC(entity_graph_node_rank_cmp) {
+	EntityGraphNodeRank const *x = cast(EntityGraphNodeRank const *)a;
+	EntityGraphNodeRank const *y = cast(EntityGraphNodeRank const *)b;
+	int cmp = u64_cmp(x->order_in_src, y->order_in_src);
+	if (cmp == 0) {
+		cmp = isize_cmp(x->index, y->index);
+	}
+	return cmp;
 }
 
 
@@ -182,6 +171,7 @@ gb_internal void init_decl_info(DeclInfo *d, Scope *scope, DeclInfo *parent) {
 
 gb_internal DeclInfo *make_decl_info(Scope *scope, DeclInfo *parent) {
 	DeclInfo *d = gb_alloc_item(permanent_allocator(), DeclInfo);
+	memory_tag_add(MemoryTag_DeclInfo, gb_size_of(DeclInfo));
 	init_decl_info(d, scope, parent);
 	return d;
 }
@@ -215,6 +205,7 @@ gb_internal DeclInfo *make_decl_info(Scope *scope, DeclInfo *parent) {
 
 gb_internal Scope *create_scope(CheckerInfo *info, Scope *parent) {
 	Scope *s = gb_alloc_item(permanent_allocator(), Scope);
+	memory_tag_add(MemoryTag_Scope, gb_size_of(Scope));
 	s->parent = parent;
 
 	if (parent != nullptr && parent != builtin_pkg->scope) {
@@ -1402,6 +1393,7 @@ gb_internal void init_checker_info(CheckerInfo *i) {
 
 	type_set_init(&i->min_dep_type_info_set);
 	map_init(&i->min_dep_type_info_index_map);
+	array_init(&i->minimum_dependency_frontier, a);
 
 	// map_init(&i->type_info_map);
 	string_map_init(&i->files);
@@ -1443,6 +1435,7 @@ gb_internal void destroy_checker_info(CheckerInfo *i) {
 
 	type_set_destroy(&i->min_dep_type_info_set);
 	map_destroy(&i->min_dep_type_info_index_map);
+	array_free(&i->minimum_dependency_frontier);
 
 	string_map_destroy(&i->files);
 	string_map_destroy(&i->packages);
@@ -1890,6 +1883,12 @@ gb_internal void add_entity_use(CheckerContext *c, Ast *identifier, Entity *enti
 	}
 	add_declaration_dependency(c, entity);
 	entity->flags |= EntityFlag_Used;
+	if (entity->kind == Entity_Variable && entity->Variable.zero_init == VariableZeroInit_Pending) {
+		// NOTE: Counted once per identifier, as some expressions are checked more than once
+		if (identifier == nullptr || identifier->kind != Ast_Ident || identifier->Ident.entity != entity) {
+			entity->Variable.zero_init_uses += 1;
+		}
+	}
 	if (entity_has_deferred_procedure(entity)) {
 		Entity *deferred = entity->Procedure.deferred_procedure.entity;
 		if (deferred != entity) {
@@ -1903,11 +1902,12 @@ gb_internal void add_entity_use(CheckerContext *c, Ast *identifier, Entity *enti
 
 	identifier->Ident.entity = entity;
 
-	String dmsg = entity->deprecated_message;
+	EntityCold const *cold = entity_cold(entity);
+	String dmsg = cold->deprecated_message;
 	if (dmsg.len > 0) {
 		warning(identifier, "%.*s is deprecated: %.*s", LIT(entity->token.string), LIT(dmsg));
 	}
-	String wmsg = entity->warning_message;
+	String wmsg = cold->warning_message;
 	if (wmsg.len > 0) {
 		warning(identifier, "%.*s: %.*s", LIT(entity->token.string), LIT(wmsg));
 	}
@@ -2330,21 +2330,35 @@ gb_internal void check_procedure_later(Checker *c, AstFile *file, Token token, D
 }
 
 
-gb_internal void add_min_dep_type_info(Checker *c, Type *t) {
+gb_internal void add_min_dep_type_info(Checker *c, TypeInfoPair pair);
+
+gb_internal bool min_dep_type_info_pair(Type *t, TypeInfoPair *pair_) {
 	if (t == nullptr) {
-		return;
+		return false;
 	}
 	t = default_type(t);
 	if (is_type_untyped(t)) {
-		return; // Could be nil
+		return false; // Could be nil
 	}
 	if (is_type_polymorphic(base_type(t))) {
-		return;
+		return false;
 	}
+	*pair_ = TypeInfoPair{t, type_hash_canonical_type(t)};
+	return true;
+}
 
-	if (type_set_update(&c->info.min_dep_type_info_set, t)) {
+gb_internal void add_min_dep_type_info(Checker *c, Type *t) {
+	TypeInfoPair pair = {};
+	if (min_dep_type_info_pair(t, &pair)) {
+		add_min_dep_type_info(c, pair);
+	}
+}
+
+gb_internal void add_min_dep_type_info(Checker *c, TypeInfoPair pair) {
+	if (type_set_update(&c->info.min_dep_type_info_set, pair)) {
 		return;
 	}
+	Type *t = pair.type;
 
 	// Add nested types
 	if (t->kind == Type_Named) {
@@ -2518,51 +2532,133 @@ gb_internal void add_min_dep_type_info(Checker *c, Type *t) {
 }
 
 
-gb_internal void add_dependency_to_set(Checker *c, Entity *entity) {
+gb_internal bool is_minimum_dependency_candidate(Entity *entity) {
 	if (entity == nullptr) {
-		return;
+		return false;
 	}
-
-	CheckerInfo *info = &c->info;
-	auto *set = &info->minimum_dependency_set;
-
 	if (entity->type != nullptr &&
 	    is_type_polymorphic(entity->type)) {
 		DeclInfo *decl = decl_info_of_entity(entity);
 		if (decl != nullptr && decl->gen_proc_type == nullptr) {
-			return;
+			return false;
 		}
 	}
+	return true;
+}
 
-	if (ptr_set_update(set, entity)) {
+// NOTE: The dependencies of `entity` are walked later by `flush_minimum_dependency_set`
+gb_internal void add_dependency_to_set(Checker *c, Entity *entity) {
+	if (!is_minimum_dependency_candidate(entity)) {
 		return;
 	}
-
-	DeclInfo *decl = decl_info_of_entity(entity);
-	if (decl == nullptr) {
+	if (ptr_set_update(&c->info.minimum_dependency_set, entity)) {
 		return;
 	}
-	for (TypeInfoPair const tt : decl->type_info_deps) {
-		add_min_dep_type_info(c, tt.type);
+	array_add(&c->info.minimum_dependency_frontier, entity);
+}
+
+struct MinimumDependencyWorkerData {
+	CheckerInfo *       info;
+	Slice<Entity *>     frontier;
+	Array<Entity *>     found;
+	Array<TypeInfoPair> types;
+};
+
+gb_internal void minimum_dependency_found(MinimumDependencyWorkerData *wd, Entity *e) {
+	if (is_minimum_dependency_candidate(e) && !ptr_set_exists(&wd->info->minimum_dependency_set, e)) {
+		array_add(&wd->found, e);
 	}
+}
 
-	for (Entity *e : decl->deps) {
-		add_dependency_to_set(c, e);
-		if (e->kind == Entity_Procedure && e->Procedure.is_foreign) {
-			Entity *fl = e->Procedure.foreign_library;
-			if (fl != nullptr) {
-				GB_ASSERT_MSG(fl->kind == Entity_LibraryName &&
-				              (fl->flags&EntityFlag_Used),
-				              "%.*s", LIT(entity->token.string));
-				add_dependency_to_set(c, fl);
+gb_internal WORKER_TASK_PROC(minimum_dependency_set_worker_proc) {
+	MinimumDependencyWorkerData *wd = cast(MinimumDependencyWorkerData *)data;
+	TypeSet *type_set = &wd->info->min_dep_type_info_set;
+
+	for (Entity *entity : wd->frontier) {
+		DeclInfo *decl = decl_info_of_entity(entity);
+		if (decl == nullptr) {
+			continue;
+		}
+		for (TypeInfoPair const tt : decl->type_info_deps) {
+			TypeInfoPair pair = {};
+			if (min_dep_type_info_pair(tt.type, &pair) && !type_set_exists(type_set, pair)) {
+				array_add(&wd->types, pair);
 			}
-		} else if (e->kind == Entity_Variable && e->Variable.is_foreign) {
-			Entity *fl = e->Variable.foreign_library;
-			if (fl != nullptr) {
-				GB_ASSERT_MSG(fl->kind == Entity_LibraryName &&
-				              (fl->flags&EntityFlag_Used),
-				              "%.*s", LIT(entity->token.string));
-				add_dependency_to_set(c, fl);
+		}
+
+		for (Entity *e : decl->deps) {
+			minimum_dependency_found(wd, e);
+			if (e->kind == Entity_Procedure && e->Procedure.is_foreign) {
+				Entity *fl = e->Procedure.foreign_library;
+				if (fl != nullptr) {
+					GB_ASSERT_MSG(fl->kind == Entity_LibraryName &&
+					              (fl->flags&EntityFlag_Used),
+					              "%.*s", LIT(entity->token.string));
+					minimum_dependency_found(wd, fl);
+				}
+			} else if (e->kind == Entity_Variable && e->Variable.is_foreign) {
+				Entity *fl = entity_cold(e)->foreign_library;
+				if (fl != nullptr) {
+					GB_ASSERT_MSG(fl->kind == Entity_LibraryName &&
+					              (fl->flags&EntityFlag_Used),
+					              "%.*s", LIT(entity->token.string));
+					minimum_dependency_found(wd, fl);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+// NOTE: Breadth-first walk of the dependencies of everything added with `add_dependency_to_set`.
+// Each level of the frontier is expanded on the thread pool against the (read-only) sets, and the
+// results are then merged in frontier order so the contents and insertion order are deterministic.
+gb_internal void flush_minimum_dependency_set(Checker *c) {
+	CheckerInfo *info = &c->info;
+	auto *frontier = &info->minimum_dependency_frontier;
+
+	isize const ENTITIES_PER_TASK = 256;
+
+	auto worker_data = array_make<MinimumDependencyWorkerData>(heap_allocator(), 0, 0);
+	defer ({
+		for (auto &wd : worker_data) {
+			array_free(&wd.found);
+			array_free(&wd.types);
+		}
+		array_free(&worker_data);
+	});
+
+	while (frontier->count > 0) {
+		isize task_count = (frontier->count + ENTITIES_PER_TASK-1) / ENTITIES_PER_TASK;
+		while (worker_data.count < task_count) {
+			MinimumDependencyWorkerData wd = {};
+			wd.info = info;
+			array_init(&wd.found, heap_allocator());
+			array_init(&wd.types, heap_allocator());
+			array_add(&worker_data, wd);
+		}
+
+		for (isize i = 0; i < task_count; i++) {
+			MinimumDependencyWorkerData *wd = &worker_data[i];
+			isize lo = i*ENTITIES_PER_TASK;
+			isize hi = gb_min(lo+ENTITIES_PER_TASK, frontier->count);
+			wd->frontier = slice(*frontier, lo, hi);
+			array_clear(&wd->found);
+			array_clear(&wd->types);
+			thread_pool_add_task(minimum_dependency_set_worker_proc, wd);
+		}
+		thread_pool_wait();
+
+		array_clear(frontier);
+		for (isize i = 0; i < task_count; i++) {
+			MinimumDependencyWorkerData *wd = &worker_data[i];
+			for (TypeInfoPair const &pair : wd->types) {
+				add_min_dep_type_info(c, pair);
+			}
+			for (Entity *e : wd->found) {
+				if (!ptr_set_update(&info->minimum_dependency_set, e)) {
+					array_add(frontier, e);
+				}
 			}
 		}
 	}
@@ -2744,6 +2840,8 @@ gb_internal void generate_minimum_dependency_set_internal(Checker *c, Entity *st
 		start->flags |= EntityFlag_Used;
 		add_dependency_to_set(c, start);
 	}
+
+	flush_minimum_dependency_set(c);
 }
 
 gb_internal void generate_minimum_dependency_set(Checker *c, Entity *start) {
@@ -2868,113 +2966,295 @@ gb_internal bool is_entity_a_dependency(Entity *e) {
 	return false;
 }
 
+gb_internal bool is_entity_a_graph_dependency(Entity *dep) {
+	GB_ASSERT(dep != nullptr);
+	if (dep->flags & EntityFlag_Field) {
+		return false;
+	}
+	return is_entity_a_dependency(dep);
+}
+
+struct EntityReachInfo {
+	isize index;
+	isize lowlink;
+	isize scc; // -1 until its strongly connected component is complete
+};
+
+struct EntityReachFrame {
+	Entity *entity;
+	isize   begin; // Its dependencies are `edges[begin..<end]`
+	isize   next;
+	isize   end;
+};
+
+// NOTE: Only the edges between global variables are needed for the initialization order, so rather than
+// building the full entity graph and splicing out every procedure node (quadratic in fan-in*fan-out for
+// hub procedures), the procedures and constants are collapsed into their strongly connected components and
+// the set of variables reachable from each component is computed once over the condensed DAG
+struct EntityReachability {
+	PtrMap<Entity *, EntityGraphNode *> *variables;
+
+	PtrMap<Entity *, isize>          info_index;
+	Array<EntityReachInfo>           infos;
+	Array<Slice<EntityGraphNode *>>  scc_reach; // Indexed by `EntityReachInfo.scc`
+
+	Array<Entity *>                  tarjan_stack;
+	Array<EntityReachFrame>          frames;
+	Array<Entity *>                  edges;
+	Array<EntityGraphNode *>         reach;
+	PtrMap<EntityGraphNode *, isize> reach_scc; // The last component whose `reach` a variable was added to
+};
+
+gb_internal EntityReachInfo *entity_reach_info(EntityReachability *r, Entity *e) {
+	isize *found = map_get(&r->info_index, e);
+	if (found == nullptr) {
+		return nullptr;
+	}
+	return &r->infos[*found];
+}
+
+gb_internal void entity_reach_push_frame(EntityReachability *r, Entity *e) {
+	map_set(&r->info_index, e, r->infos.count);
+	EntityReachInfo info = {};
+	info.index   = r->infos.count;
+	info.lowlink = r->infos.count;
+	info.scc     = -1;
+	array_add(&r->infos, info);
+	array_add(&r->tarjan_stack, e);
+
+	EntityReachFrame frame = {};
+	frame.entity = e;
+	frame.begin  = r->edges.count;
+	frame.next   = r->edges.count;
+
+	DeclInfo *decl = decl_info_of_entity(e);
+	GB_ASSERT(decl != nullptr);
+	for (Entity *dep : decl->deps) {
+		if (is_entity_a_graph_dependency(dep) && dep->kind != Entity_Variable) {
+			array_add(&r->edges, dep);
+		}
+	}
+	frame.end = r->edges.count;
+	array_add(&r->frames, frame);
+}
+
+// NOTE: The members of a component are `tarjan_stack[first..]`, and every component they depend upon is already complete
+gb_internal void entity_reach_complete_scc(EntityReachability *r, isize first) {
+	isize scc = r->scc_reach.count;
+	for (isize i = first; i < r->tarjan_stack.count; i++) {
+		entity_reach_info(r, r->tarjan_stack[i])->scc = scc;
+	}
+
+	auto add_reach = [](EntityReachability *r, EntityGraphNode *n, isize scc) {
+		isize *found = map_get(&r->reach_scc, n);
+		if (found == nullptr || *found != scc) {
+			map_set(&r->reach_scc, n, scc);
+			array_add(&r->reach, n);
+		}
+	};
+
+	array_clear(&r->reach);
+	for (isize i = first; i < r->tarjan_stack.count; i++) {
+		DeclInfo *decl = decl_info_of_entity(r->tarjan_stack[i]);
+		for (Entity *dep : decl->deps) {
+			if (!is_entity_a_graph_dependency(dep)) {
+				continue;
+			}
+			if (dep->kind == Entity_Variable) {
+				add_reach(r, map_must_get(r->variables, dep), scc);
+				continue;
+			}
+			isize dep_scc = entity_reach_info(r, dep)->scc;
+			if (dep_scc != scc) {
+				for (EntityGraphNode *n : r->scc_reach[dep_scc]) {
+					add_reach(r, n, scc);
+				}
+			}
+		}
+	}
+
+	array_add(&r->scc_reach, slice_clone(heap_allocator(), slice(r->reach, 0, r->reach.count)));
+
+	array_resize(&r->tarjan_stack, first);
+}
+
+// NOTE: An iterative Tarjan's algorithm, as the call graph of a large program is far too deep to recurse over
+gb_internal void entity_reach_visit(EntityReachability *r, Entity *root) {
+	entity_reach_push_frame(r, root);
+	while (r->frames.count > 0) {
+		EntityReachFrame *f = &r->frames[r->frames.count-1];
+		if (f->next < f->end) {
+			Entity *w = r->edges[f->next++];
+			EntityReachInfo *w_info = entity_reach_info(r, w);
+			if (w_info == nullptr) {
+				entity_reach_push_frame(r, w);
+			} else if (w_info->scc < 0) {
+				EntityReachInfo *info = entity_reach_info(r, f->entity);
+				info->lowlink = gb_min(info->lowlink, w_info->index);
+			}
+			continue;
+		}
+
+		EntityReachFrame frame = array_pop(&r->frames);
+		array_resize(&r->edges, frame.begin);
+
+		EntityReachInfo info = *entity_reach_info(r, frame.entity);
+		if (info.lowlink == info.index) {
+			isize first = r->tarjan_stack.count-1;
+			while (r->tarjan_stack[first] != frame.entity) {
+				first -= 1;
+			}
+			entity_reach_complete_scc(r, first);
+		}
+		if (r->frames.count > 0) {
+			EntityReachInfo *parent = entity_reach_info(r, r->frames[r->frames.count-1].entity);
+			parent->lowlink = gb_min(parent->lowlink, info.lowlink);
+		}
+	}
+}
+
+struct EntityGraphEdgeTask {
+	EntityReachability *reachability;
+	Slice<EntityGraphNode *> nodes;
+};
+
+gb_internal WORKER_TASK_PROC(generate_entity_dependency_edges_worker_proc) {
+	EntityGraphEdgeTask *task = cast(EntityGraphEdgeTask *)data;
+	EntityReachability *r = task->reachability;
+
+	for (EntityGraphNode *n : task->nodes) {
+		DeclInfo *decl = decl_info_of_entity(n->entity);
+		GB_ASSERT(decl != nullptr);
+
+		for (Entity *dep : decl->deps) {
+			if (!is_entity_a_graph_dependency(dep)) {
+				continue;
+			}
+			if (dep->kind == Entity_Variable) {
+				entity_graph_node_set_add(&n->succ, map_must_get(r->variables, dep));
+				continue;
+			}
+			EntityReachInfo *info = entity_reach_info(r, dep);
+			GB_ASSERT(info != nullptr && info->scc >= 0);
+			for (EntityGraphNode *s : r->scc_reach[info->scc]) {
+				entity_graph_node_set_add(&n->succ, s);
+			}
+		}
+	}
+	return 0;
+}
+
+gb_internal WORKER_TASK_PROC(count_entity_dependency_preds_worker_proc) {
+	EntityGraphEdgeTask *task = cast(EntityGraphEdgeTask *)data;
+	for (EntityGraphNode *n : task->nodes) {
+		for (EntityGraphNode *s : n->succ) {
+			s->pred_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	return 0;
+}
+
+// NOTE: The order within each `pred` depends on scheduling, which is fine as it is only used to count down `dep_count`
+gb_internal WORKER_TASK_PROC(fill_entity_dependency_preds_worker_proc) {
+	EntityGraphEdgeTask *task = cast(EntityGraphEdgeTask *)data;
+	for (EntityGraphNode *n : task->nodes) {
+		for (EntityGraphNode *s : n->succ) {
+			isize i = s->pred_count.fetch_add(1, std::memory_order_relaxed);
+			s->pred[i] = n;
+		}
+	}
+	return 0;
+}
+
 gb_internal Array<EntityGraphNode *> generate_entity_dependency_graph(CheckerInfo *info, gbAllocator allocator) {
 	PtrMap<Entity *, EntityGraphNode *> M = {};
-	map_init(&M, info->entities.count);
+	map_init(&M);
 	defer (map_destroy(&M));
+
+	auto G = array_make<EntityGraphNode *>(allocator, 0, 0);
 	for_array(i, info->entities) {
 		Entity *e = info->entities[i];
-		if (is_entity_a_dependency(e)) {
+		if (e->kind == Entity_Variable && is_entity_a_dependency(e)) {
 			EntityGraphNode *n = gb_alloc_item(allocator, EntityGraphNode);
 			n->entity = e;
 			map_set(&M, e, n);
+			array_add(&G, n);
 		}
 	}
 
 	TIME_SECTION("generate_entity_dependency_graph: Calculate edges for graph M - Part 1");
-	// Calculate edges for graph M
-	for (auto const &entry : M) {
-		EntityGraphNode *n = entry.value;
-		Entity *e = n->entity;
+	EntityReachability r = {};
+	r.variables = &M;
+	map_init(&r.info_index);
+	array_init(&r.infos,        heap_allocator());
+	array_init(&r.scc_reach,    heap_allocator());
+	array_init(&r.tarjan_stack, heap_allocator());
+	array_init(&r.frames,       heap_allocator());
+	array_init(&r.edges,        heap_allocator());
+	array_init(&r.reach,        heap_allocator());
+	map_init(&r.reach_scc);
+	defer ({
+		for (auto &reach : r.scc_reach) {
+			slice_free(&reach, heap_allocator());
+		}
+		map_destroy(&r.info_index);
+		array_free(&r.infos);
+		array_free(&r.scc_reach);
+		array_free(&r.tarjan_stack);
+		array_free(&r.frames);
+		array_free(&r.edges);
+		array_free(&r.reach);
+		map_destroy(&r.reach_scc);
+	});
 
-		DeclInfo *decl = decl_info_of_entity(e);
+	for (EntityGraphNode *n : G) {
+		DeclInfo *decl = decl_info_of_entity(n->entity);
 		GB_ASSERT(decl != nullptr);
-
 		for (Entity *dep : decl->deps) {
-			if (dep->flags & EntityFlag_Field) {
-				continue;
-			}
-			GB_ASSERT(dep != nullptr);
-			if (is_entity_a_dependency(dep)) {
-				EntityGraphNode *m = map_must_get(&M, dep);
-				entity_graph_node_set_add(&n->succ, m);
-				entity_graph_node_set_add(&m->pred, n);
+			if (is_entity_a_graph_dependency(dep) && dep->kind != Entity_Variable &&
+			    map_get(&r.info_index, dep) == nullptr) {
+				entity_reach_visit(&r, dep);
 			}
 		}
 	}
 
+	isize const NODES_PER_TASK = 64;
+	isize task_count = (G.count + NODES_PER_TASK-1) / NODES_PER_TASK;
+	auto tasks = array_make<EntityGraphEdgeTask>(heap_allocator(), task_count);
+	defer (array_free(&tasks));
+
+	for (isize i = 0; i < task_count; i++) {
+		isize lo = i*NODES_PER_TASK;
+		isize hi = gb_min(lo+NODES_PER_TASK, G.count);
+		tasks[i].reachability = &r;
+		tasks[i].nodes = slice(G, lo, hi);
+		thread_pool_add_task(generate_entity_dependency_edges_worker_proc, &tasks[i]);
+	}
+	thread_pool_wait();
+
 	TIME_SECTION("generate_entity_dependency_graph: Calculate edges for graph M - Part 2");
-	auto G = array_make<EntityGraphNode *>(allocator, 0, M.count);
-
-	for (auto const &m_entry : M) {
-		auto *e = m_entry.key;
-		EntityGraphNode *n = m_entry.value;
-
-		if (e->kind == Entity_Procedure) {
-			// Connect each pred 'p' of 'n' with each succ 's' and from
-			// the procedure node
-			for (EntityGraphNode *p : n->pred) {
-				// Ignore self-cycles
-				if (p != n) {
-					// Each succ 's' of 'n' becomes a succ of 'p', and
-					// each pred 'p' of 'n' becomes a pred of 's'
-					for (EntityGraphNode *s  : n->succ) {
-						// Ignore self-cycles
-						if (s != n) {
-							if (p->entity->kind == Entity_Procedure &&
-							    s->entity->kind == Entity_Procedure) {
-							    	// NOTE(bill, 2020-11-15): Only care about variable initialization ordering
-							    	// TODO(bill): This is probably wrong!!!!
-								continue;
-							}
-							// IMPORTANT NOTE/TODO(bill, 2020-11-15): These three calls take the majority of the
-							// the time to process
-							entity_graph_node_set_add(&p->succ, s);
-							entity_graph_node_set_add(&s->pred, p);
-							// Remove edge to 'n'
-							entity_graph_node_set_remove(&s->pred, n);
-						}
-					}
+	for (auto &task : tasks) {
+		thread_pool_add_task(count_entity_dependency_preds_worker_proc, &task);
+	}
+	thread_pool_wait();
 
-					// Remove edge to 'n'
-					entity_graph_node_set_remove(&p->succ, n);
-				}
-			}
-		} else if (e->kind == Entity_Variable) {
-			array_add(&G, n);
-		}
+	for (EntityGraphNode *n : G) {
+		n->pred = slice_make<EntityGraphNode *>(allocator, n->pred_count.load(std::memory_order_relaxed));
+		n->pred_count.store(0, std::memory_order_relaxed);
 	}
 
+	for (auto &task : tasks) {
+		thread_pool_add_task(fill_entity_dependency_preds_worker_proc, &task);
+	}
+	thread_pool_wait();
+
 	TIME_SECTION("generate_entity_dependency_graph: Dependency Count Checker");
 	for_array(i, G) {
 		EntityGraphNode *n = G[i];
-		n->index = i;
 		n->dep_count = n->succ.count;
 		GB_ASSERT(n->dep_count >= 0);
 	}
 
-	// f64 succ_count = 0.0;
-	// f64 pred_count = 0.0;
-	// f64 succ_capacity = 0.0;
-	// f64 pred_capacity = 0.0;
-	// f64 succ_max = 0.0;
-	// f64 pred_max = 0.0;
-	// for_array(i, G) {
-	// 	EntityGraphNode *n = G[i];
-	// 	succ_count += n->succ.entries.count;
-	// 	pred_count += n->pred.entries.count;
-	// 	succ_capacity += n->succ.entries.capacity;
-	// 	pred_capacity += n->pred.entries.capacity;
-
-	// 	succ_max = gb_max(succ_max, n->succ.entries.capacity);
-	// 	pred_max = gb_max(pred_max, n->pred.entries.capacity);
-
-	// }
-	// f64 count = cast(f64)G.count;
-	// gb_printf_err(">>>count    pred: %f succ: %f\n", pred_count/count, succ_count/count);
-	// gb_printf_err(">>>capacity pred: %f succ: %f\n", pred_capacity/count, succ_capacity/count);
-	// gb_printf_err(">>>max      pred: %f succ: %f\n", pred_max, succ_max);
-
 	return G;
 }
 
@@ -4420,10 +4700,11 @@ gb_internal void check_collect_value_decl(CheckerContext *c, Ast *decl) {
 			if (fl != nullptr) {
 				GB_ASSERT(fl->kind == Ast_Ident);
 				e->Variable.is_foreign = true;
-				e->Variable.foreign_library_ident = fl;
 
-				e->Variable.link_prefix = c->foreign_context.link_prefix;
-				e->Variable.link_suffix = c->foreign_context.link_suffix;
+				EntityCold *cold = entity_make_cold(e);
+				cold->foreign_library_ident = fl;
+				cold->link_prefix = c->foreign_context.link_prefix;
+				cold->link_suffix = c->foreign_context.link_suffix;
 			}
 
 			Ast *init_expr = value;
@@ -4776,6 +5057,171 @@ gb_internal void check_single_global_entity(Checker *c, Entity *e, DeclInfo *d)
 	check_entity_decl(ctx, e, d, nullptr);
 }
 
+struct TypeLayoutPass {
+	PtrMap<Type *, isize> levels; // base record type -> level, see `type_layout_level`
+	Array<Array<Type *>>  records_by_level;
+};
+
+enum : isize {
+	TypeLayoutLevel_Unknown  = -1, // contains something which must be laid out lazily
+	TypeLayoutLevel_Visiting = -2,
+};
+
+gb_internal isize type_layout_level(TypeLayoutPass *p, Type *t);
+
+// NOTE: Returns the highest level of the records contained by value in `t`, 0 if there are none
+gb_internal isize type_layout_contents_level(TypeLayoutPass *p, Type *t) {
+	if (t == nullptr || t->failure) {
+		return TypeLayoutLevel_Unknown;
+	}
+	switch (t->kind) {
+	case Type_Named: {
+		Type *bt = base_type(t);
+		if (bt == nullptr || bt->kind == Type_Named) {
+			return TypeLayoutLevel_Unknown;
+		}
+		return type_layout_level(p, bt);
+	}
+
+	case Type_Basic:
+		return is_type_typed(t) ? 0 : TypeLayoutLevel_Unknown;
+
+	case Type_Pointer:
+	case Type_MultiPointer:
+	case Type_SoaPointer:
+	case Type_Slice:
+	case Type_DynamicArray:
+	case Type_Map:
+	case Type_Proc:
+	case Type_Enum:
+	case Type_BitSet:
+	case Type_BitField:
+		return 0;
+
+	case Type_Array:
+		return type_layout_contents_level(p, t->Array.elem);
+	case Type_EnumeratedArray:
+		return type_layout_contents_level(p, t->EnumeratedArray.elem);
+	case Type_SimdVector:
+		return type_layout_contents_level(p, t->SimdVector.elem);
+	case Type_Matrix:
+		return type_layout_contents_level(p, t->Matrix.elem);
+
+	case Type_Struct: {
+		if (t->Struct.soa_kind != StructSoa_None || is_type_polymorphic_record_unspecialized(t)) {
+			return TypeLayoutLevel_Unknown;
+		}
+		isize level = 0;
+		for (Entity *f : t->Struct.fields) {
+			isize l = type_layout_contents_level(p, f->type);
+			if (l < 0) {
+				return TypeLayoutLevel_Unknown;
+			}
+			level = gb_max(level, l);
+		}
+		return level;
+	}
+	case Type_Union: {
+		if (is_type_polymorphic_record_unspecialized(t)) {
+			return TypeLayoutLevel_Unknown;
+		}
+		isize level = 0;
+		for (Type *v : t->Union.variants) {
+			isize l = type_layout_contents_level(p, v);
+			if (l < 0) {
+				return TypeLayoutLevel_Unknown;
+			}
+			level = gb_max(level, l);
+		}
+		return level;
+	}
+	}
+	return TypeLayoutLevel_Unknown;
+}
+
+// NOTE: The level of a record type is one more than the highest level of the records it contains by value,
+// so all of the records of a level can be laid out once the lower levels have been
+gb_internal isize type_layout_level(TypeLayoutPass *p, Type *t) {
+	GB_ASSERT(t->kind != Type_Named);
+	if (isize *found = map_get(&p->levels, t)) {
+		return *found == TypeLayoutLevel_Visiting ? TypeLayoutLevel_Unknown : *found;
+	}
+	bool is_record = t->kind == Type_Struct || t->kind == Type_Union;
+	if (is_record && t->cached_size >= 0 && t->cached_align > 0) {
+		map_set(&p->levels, t, cast(isize)0);
+		return 0;
+	}
+
+	map_set(&p->levels, t, cast(isize)TypeLayoutLevel_Visiting);
+	isize level = type_layout_contents_level(p, t);
+	if (is_record && level >= 0) {
+		level += 1;
+		while (p->records_by_level.count <= level) {
+			array_add(&p->records_by_level, array_make<Type *>(heap_allocator()));
+		}
+		array_add(&p->records_by_level[level], t);
+	}
+	map_set(&p->levels, t, level);
+	return level;
+}
+
+struct TypeLayoutWorkerData {
+	Slice<Type *> records;
+};
+
+gb_internal WORKER_TASK_PROC(check_type_layouts_worker_proc) {
+	TypeLayoutWorkerData *wd = cast(TypeLayoutWorkerData *)data;
+	for (Type *t : wd->records) {
+		type_cache_layout(t);
+	}
+	return 0;
+}
+
+// NOTE: Lays out every named record type level by level on the thread pool, so that later phases and the
+// backends only read the cached sizes, alignments and offsets instead of computing them under `g_type_mutex`
+gb_internal void check_type_layouts(Checker *c) {
+	TypeLayoutPass p = {};
+	map_init(&p.levels);
+	array_init(&p.records_by_level, heap_allocator());
+	defer ({
+		for (auto &records : p.records_by_level) {
+			array_free(&records);
+		}
+		array_free(&p.records_by_level);
+		map_destroy(&p.levels);
+	});
+
+	for (Entity *e : c->info.entities) {
+		if (e->kind != Entity_TypeName || (e->flags & EntityFlag_Lazy)) {
+			continue;
+		}
+		if (e->type == nullptr || e->type->kind != Type_Named) {
+			continue;
+		}
+		Type *bt = base_type(e->type);
+		if (bt != nullptr && (bt->kind == Type_Struct || bt->kind == Type_Union)) {
+			type_layout_level(&p, bt);
+		}
+	}
+
+	isize const RECORDS_PER_TASK = 64;
+
+	auto worker_data = array_make<TypeLayoutWorkerData>(heap_allocator(), 0, 0);
+	defer (array_free(&worker_data));
+
+	for (auto const &records : p.records_by_level) {
+		isize task_count = (records.count + RECORDS_PER_TASK-1) / RECORDS_PER_TASK;
+		array_resize(&worker_data, task_count);
+		for (isize i = 0; i < task_count; i++) {
+			isize lo = i*RECORDS_PER_TASK;
+			isize hi = gb_min(lo+RECORDS_PER_TASK, records.count);
+			worker_data[i].records = slice(records, lo, hi);
+			thread_pool_add_task(check_type_layouts_worker_proc, &worker_data[i]);
+		}
+		thread_pool_wait();
+	}
+}
+
 gb_internal void check_all_global_entities(Checker *c) {
 	in_single_threaded_checker_stage = true;
 
@@ -4793,7 +5239,18 @@ gb_internal void check_all_global_entities(Checker *c) {
 			for (Type *t = nullptr; mpsc_dequeue(&c->soa_types_to_complete, &t); /**/) {
 				complete_soa_type(c, t, false);
 			}
+		}
+	}
 
+	thread_pool_wait();
+	check_type_layouts(c);
+
+	// NOTE: Anything which could not be laid out ahead of time (e.g. illegal cycles) is reported here
+	for (Entity *e : c->info.entities) {
+		if (e->flags & EntityFlag_Lazy) {
+			continue;
+		}
+		if (e->type != nullptr && is_type_typed(e->type)) {
 			(void)type_size_of(e->type);
 			(void)type_align_of(e->type);
 		}
@@ -5621,6 +6078,48 @@ gb_internal void check_export_entities(Checker *c) {
 	thread_pool_wait();
 }
 
+// NOTE: Whether collecting the file decls of a package only touches the package itself, i.e. it has no file scope
+// `when` statements, which may check any global entity and declare more entities and imports
+gb_internal bool pkg_file_decls_are_local(AstPackage *pkg) {
+	for (AstFile *f : pkg->files) {
+		for (Ast *decl : f->decls) {
+			if (decl->kind == Ast_WhenStmt) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+gb_internal WORKER_TASK_PROC(collect_file_decls_in_pkg_worker_proc) {
+	AstPackage *pkg = cast(AstPackage *)data;
+	auto *wd = &collect_entity_worker_data[current_thread_index()];
+
+	for_array(i, pkg->files) {
+		AstFile *f = pkg->files[i];
+		reset_checker_context(&wd->ctx, f, &wd->untyped);
+		wd->ctx.collect_delayed_decls = true;
+
+		bool restart = collect_file_decls(&wd->ctx, f->decls);
+		GB_ASSERT(!restart);
+		add_untyped_expressions(wd->ctx.info, &wd->untyped);
+	}
+	return 0;
+}
+
+gb_internal WORKER_TASK_PROC(correct_type_aliases_in_pkg_worker_proc) {
+	AstPackage *pkg = cast(AstPackage *)data;
+	auto *wd = &collect_entity_worker_data[current_thread_index()];
+
+	// NOTE: Names are looked up from each file in turn, so file private entities are taken into account
+	for_array(i, pkg->files) {
+		AstFile *f = pkg->files[i];
+		reset_checker_context(&wd->ctx, f, &wd->untyped);
+		correct_type_aliases_in_scope(&wd->ctx, pkg->scope);
+	}
+	return 0;
+}
+
 gb_internal void check_import_entities(Checker *c) {
 	Array<ImportGraphNode *> dep_graph = generate_import_dependency_graph(c);
 	defer ({
@@ -5688,39 +6187,100 @@ gb_internal void check_import_entities(Checker *c) {
 	UntypedExprInfoMap untyped = {};
 	defer (map_destroy(&untyped));
 
-	isize min_pkg_index = 0;
-	for (isize pkg_index = 0; pkg_index < package_order.count; pkg_index++) {
-		ImportGraphNode *node = package_order[pkg_index];
-		AstPackage *pkg = node->pkg;
-		pkg->order = 1+pkg_index;
+	// NOTE: A package's level in the import graph is one more than the deepest package it imports, so packages of
+	// the same level never see each other's declarations and can be collected at once
+	PtrMap<ImportGraphNode *, isize> import_levels = {};
+	map_init(&import_levels, package_order.count);
+	defer (map_destroy(&import_levels));
 
-		for_array(i, pkg->files) {
-			AstFile *f = pkg->files[i];
+	isize level_count = 0;
+	for_array(i, package_order) {
+		ImportGraphNode *node = package_order[i];
+		node->pkg->order = 1+i;
 
-			reset_checker_context(&ctx, f, &untyped);
-			ctx.collect_delayed_decls = true;
+		isize level = 0;
+		for (ImportGraphNode *succ : node->succ) {
+			// NOTE: Only a package within an import cycle can import one which has no level yet
+			isize *succ_level = map_get(&import_levels, succ);
+			if (succ_level != nullptr) {
+				level = gb_max(level, *succ_level+1);
+			}
+		}
+		map_set(&import_levels, node, level);
+		level_count = gb_max(level_count, level+1);
+	}
 
-			// Check import declarations first to simplify things
-			for (Ast *decl : f->delayed_decls_queues[AstDelayQueue_Import]) {
-				check_add_import_decl(&ctx, decl);
+	Array<AstPackage *> level_pkgs = {};
+	Array<AstPackage *> serial_pkgs = {};
+	array_init(&level_pkgs, heap_allocator(), 0, package_order.count);
+	array_init(&serial_pkgs, heap_allocator(), 0, package_order.count);
+	defer (array_free(&level_pkgs));
+	defer (array_free(&serial_pkgs));
+
+	for (isize level = 0; level < level_count; level++) {
+		// NOTE: Imports are added first, on this thread, as they mark the scope of the imported package
+		array_clear(&level_pkgs);
+		array_clear(&serial_pkgs);
+		for (ImportGraphNode *node : package_order) {
+			if (map_must_get(&import_levels, node) != level) {
+				continue;
 			}
-			array_clear(&f->delayed_decls_queues[AstDelayQueue_Import]);
+			AstPackage *pkg = node->pkg;
+			for_array(i, pkg->files) {
+				AstFile *f = pkg->files[i];
+				reset_checker_context(&ctx, f, &untyped);
 
-			if (collect_file_decls(&ctx, f->decls)) {
-				check_export_entities_in_pkg(&ctx, pkg, &untyped);
-				pkg_index = min_pkg_index-1;
-				break;
+				for (Ast *decl : f->delayed_decls_queues[AstDelayQueue_Import]) {
+					check_add_import_decl(&ctx, decl);
+				}
+				array_clear(&f->delayed_decls_queues[AstDelayQueue_Import]);
+				add_untyped_expressions(ctx.info, &untyped);
 			}
+			array_add(&level_pkgs, pkg);
+		}
 
-			add_untyped_expressions(ctx.info, &untyped);
+		for (AstPackage *pkg : level_pkgs) {
+			if (pkg_file_decls_are_local(pkg)) {
+				thread_pool_add_task(collect_file_decls_in_pkg_worker_proc, pkg);
+			} else {
+				array_add(&serial_pkgs, pkg);
+			}
 		}
-		if (pkg_index < 0) {
-			continue;
+		thread_pool_wait();
+
+		// NOTE: File scope `when` conditions may check any global entity, which must be done single threaded
+		isize min_pkg_index = 0;
+		for (isize pkg_index = 0; pkg_index < serial_pkgs.count; pkg_index++) {
+			AstPackage *pkg = serial_pkgs[pkg_index];
+
+			for_array(i, pkg->files) {
+				AstFile *f = pkg->files[i];
+
+				reset_checker_context(&ctx, f, &untyped);
+				ctx.collect_delayed_decls = true;
+
+				// Check import declarations first to simplify things
+				for (Ast *decl : f->delayed_decls_queues[AstDelayQueue_Import]) {
+					check_add_import_decl(&ctx, decl);
+				}
+				array_clear(&f->delayed_decls_queues[AstDelayQueue_Import]);
+
+				if (collect_file_decls(&ctx, f->decls)) {
+					check_export_entities_in_pkg(&ctx, pkg, &untyped);
+					pkg_index = min_pkg_index-1;
+					break;
+				}
+
+				add_untyped_expressions(ctx.info, &untyped);
+			}
+			if (pkg_index < 0) {
+				continue;
+			}
+			min_pkg_index = pkg_index;
 		}
-		min_pkg_index = pkg_index;
 	}
 
-	TIME_SECTION("check_import_entities - check delayed entities");
+	TIME_SECTION("check_import_entities - check delayed imports");
 	for_array(i, package_order) {
 		ImportGraphNode *node = package_order[i];
 		GB_ASSERT(node->scope->flags&ScopeFlag_Pkg);
@@ -5736,12 +6296,20 @@ gb_internal void check_import_entities(Checker *c) {
 			array_clear(&f->delayed_decls_queues[AstDelayQueue_Import]);
 			add_untyped_expressions(ctx.info, &untyped);
 		}
+	}
 
-		for_array(i, pkg->files) {
-			AstFile *f = pkg->files[i];
-			reset_checker_context(&ctx, f, &untyped);
-			correct_type_aliases_in_scope(&ctx, pkg->scope);
-		}
+	TIME_SECTION("check_import_entities - correct type aliases");
+	// NOTE: Only the package's own scope is read and written, so every package can be done at once
+	for_array(i, package_order) {
+		thread_pool_add_task(correct_type_aliases_in_pkg_worker_proc, package_order[i]->pkg);
+	}
+	thread_pool_wait();
+
+	TIME_SECTION("check_import_entities - check delayed expressions");
+	// NOTE: These may check any global entity, which must be done single threaded and in package order
+	for_array(i, package_order) {
+		ImportGraphNode *node = package_order[i];
+		AstPackage *pkg = node->scope->pkg;
 
 		for_array(i, pkg->files) {
 			AstFile *f = pkg->files[i];
@@ -5852,6 +6420,60 @@ gb_internal Array<Entity *> find_entity_path(Entity *start, Entity *end, PtrSet<
 }
 
 
+// NOTE: A set of ranks in [0, n) which hands back its smallest member. Each bit of `summary` tells whether
+// one word of `bits` is non-zero, so the smallest member is found without walking long empty stretches.
+struct RankSet {
+	Slice<u64> bits;
+	Slice<u64> summary;
+	isize      lowest_summary; // No member is in a word before `64*lowest_summary`
+	isize      count;
+};
+
+gb_internal void rank_set_init(RankSet *s, isize n) {
+	isize word_count = (n+63)/64;
+	s->bits    = slice_make<u64>(heap_allocator(), word_count);
+	s->summary = slice_make<u64>(heap_allocator(), (word_count+63)/64);
+	s->lowest_summary = s->summary.count;
+	s->count = 0;
+}
+
+gb_internal void rank_set_destroy(RankSet *s) {
+	slice_free(&s->bits, heap_allocator());
+	slice_free(&s->summary, heap_allocator());
+}
+
+gb_internal isize rank_set_lowest_bit(u64 x) {
+	GB_ASSERT(x != 0);
+	return cast(isize)bit_set_count((x & (~x + 1)) - 1);
+}
+
+gb_internal void rank_set_add(RankSet *s, isize rank) {
+	isize word = rank/64;
+	GB_ASSERT((s->bits[word] & (1ull<<(rank%64))) == 0);
+	s->bits[word] |= 1ull<<(rank%64);
+	s->summary[word/64] |= 1ull<<(word%64);
+	s->lowest_summary = gb_min(s->lowest_summary, word/64);
+	s->count += 1;
+}
+
+gb_internal isize rank_set_pop_min(RankSet *s) {
+	GB_ASSERT(s->count > 0);
+	isize i = s->lowest_summary;
+	while (s->summary[i] == 0) {
+		i += 1;
+	}
+	s->lowest_summary = i;
+
+	isize word = 64*i + rank_set_lowest_bit(s->summary[i]);
+	isize rank = 64*word + rank_set_lowest_bit(s->bits[word]);
+	s->bits[word] &= s->bits[word]-1;
+	if (s->bits[word] == 0) {
+		s->summary[i] &= ~(1ull<<(word%64));
+	}
+	s->count -= 1;
+	return rank;
+}
+
 gb_internal void calculate_global_init_order(Checker *c) {
 	CheckerInfo *info = &c->info;
 
@@ -5864,16 +6486,47 @@ gb_internal void calculate_global_init_order(Checker *c) {
 		array_free(&dep_graph);
 	});
 
-	TIME_SECTION("calculate_global_init_order: priority queue create");
-	// NOTE(bill): Priority queue
-	auto pq = priority_queue_create(dep_graph, entity_graph_node_cmp, entity_graph_node_swap);
+	TIME_SECTION("calculate_global_init_order: rank by source order");
+	auto ranks = array_make<EntityGraphNodeRank>(heap_allocator(), dep_graph.count);
+	defer (array_free(&ranks));
+	for_array(i, dep_graph) {
+		ranks[i] = {dep_graph[i]->entity->order_in_src, i, dep_graph[i]};
+	}
+	array_sort(ranks, entity_graph_node_rank_cmp);
+
+	auto by_rank = array_make<EntityGraphNode *>(heap_allocator(), dep_graph.count);
+	defer (array_free(&by_rank));
+
+	RankSet ready = {};
+	rank_set_init(&ready, by_rank.count);
+	defer (rank_set_destroy(&ready));
+
+	for_array(i, ranks) {
+		EntityGraphNode *n = ranks[i].node;
+		by_rank[i] = n;
+		n->index = i;
+		if (n->dep_count == 0) {
+			rank_set_add(&ready, i);
+		}
+	}
 
 	PtrSet<DeclInfo *> emitted = {};
 	defer (ptr_set_destroy(&emitted));
 
-	TIME_SECTION("calculate_global_init_order: queue sort");
-	while (pq.queue.count > 0) {
-		EntityGraphNode *n = priority_queue_pop(&pq);
+	TIME_SECTION("calculate_global_init_order: topological sort");
+	// NOTE: Kahn's algorithm, always taking the earliest variable in the source out of those which are ready
+	for (isize remaining = by_rank.count; remaining > 0; remaining--) {
+		EntityGraphNode *n = nullptr;
+		if (ready.count > 0) {
+			n = by_rank[rank_set_pop_min(&ready)];
+		} else {
+			// NOTE: Only cycles are left, so take the variable with the fewest dependencies left, then the earliest
+			for (EntityGraphNode *m : by_rank) {
+				if (m->dep_count > 0 && (n == nullptr || m->dep_count < n->dep_count)) {
+					n = m;
+				}
+			}
+		}
 		Entity *e = n->entity;
 
 		if (n->dep_count > 0) {
@@ -5890,11 +6543,15 @@ gb_internal void calculate_global_init_order(Checker *c) {
 				error(e->token, "\t'%.*s'", LIT(e->token.string));
 			}
 		}
+		n->dep_count = -1; // NOTE: marks it as emitted
 
 		for (EntityGraphNode *p : n->pred) {
-			p->dep_count -= 1;
-			p->dep_count = gb_max(p->dep_count, 0);
-			priority_queue_fix(&pq, p->index);
+			if (p->dep_count > 0) {
+				p->dep_count -= 1;
+				if (p->dep_count == 0) {
+					rank_set_add(&ready, p->index);
+				}
+			}
 		}
 
 		DeclInfo *d = decl_info_of_entity(e);
@@ -6868,8 +7525,8 @@ gb_internal void check_parsed_files(Checker *c) {
 			token.pos.column  = 1;
 			if (s->pkg->files.count > 0) {
 				AstFile *f = s->pkg->files[0];
-				if (f->tokens.count > 0) {
-					token = f->tokens[0];
+				if (ast_file_token_count(f) > 0) {
+					token = ast_file_first_token(f);
 				}
 			}
 
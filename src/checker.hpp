@@ -307,10 +307,11 @@ typedef PtrSet<EntityGraphNode *> EntityGraphNodeSet;
 
 struct EntityGraphNode {
 	Entity *     entity; // Procedure, Variable, Constant
-	EntityGraphNodeSet pred;
+	Slice<EntityGraphNode *> pred;
 	EntityGraphNodeSet succ;
-	isize        index; // Index in array/queue
+	isize        index; // Rank in source order
 	isize        dep_count;
+	std::atomic<isize> pred_count; // Only used while `pred` is being filled in
 };
 
 
@@ -441,6 +442,7 @@ struct CheckerInfo {
 	Scope *               init_scope;
 	Entity *              entry_point;
 	PtrSet<Entity *>      minimum_dependency_set;
+	Array<Entity *>       minimum_dependency_frontier; // added to the set but their dependencies are not walked yet
 	BlockingMutex minimum_dependency_type_info_mutex;
 	PtrMap</*type info hash*/u64, /*min dep index*/isize> min_dep_type_info_index_map;
 	TypeSet             min_dep_type_info_set;
@@ -1,5 +1,7 @@
 #if defined(GB_SYSTEM_LINUX)
 #include <malloc.h>
+#elif defined(GB_SYSTEM_OSX)
+#include <malloc/malloc.h>
 #endif
 
 template <typename U, typename V>
@@ -35,11 +37,93 @@ gb_internal void virtual_memory_init(void) {
 gb_internal Thread *get_current_thread(void);
 
 
+enum MemoryTag : u8 {
+	MemoryTag_PermanentArena,
+	MemoryTag_TemporaryArena,
+	MemoryTag_Ast,
+	MemoryTag_Tokens,
+	MemoryTag_Type,
+	MemoryTag_Entity,
+	MemoryTag_DeclInfo,
+	MemoryTag_Scope,
+	MemoryTag_Map,
+	MemoryTag_MallocHeap, // sampled at section boundaries, and includes everything LLVM allocates
+
+	MemoryTag_COUNT,
+};
+
+gb_global char const *memory_tag_names[MemoryTag_COUNT] = {
+	"permanent arenas",
+	"temporary arenas",
+	"AST nodes",
+	"tokens",
+	"types",
+	"entities",
+	"decl infos",
+	"scopes",
+	"maps & sets",
+	"malloc heap",
+};
+
+struct MemoryTagUsage {
+	std::atomic<isize> current;
+	std::atomic<isize> peak; // since the last `memory_tags_reset_peaks`
+};
+
+// NOTE: Arenas are always accounted for as they only change a block at a time; the finer grained
+// tags are only counted when timings are shown
+gb_global bool           global_memory_tags_enabled;
+gb_global MemoryTagUsage global_memory_tags[MemoryTag_COUNT];
+
+gb_internal void memory_tag_update(MemoryTag tag, isize delta) {
+	MemoryTagUsage *usage = &global_memory_tags[tag];
+	isize current = usage->current.fetch_add(delta, std::memory_order_relaxed) + delta;
+	isize peak = usage->peak.load(std::memory_order_relaxed);
+	while (current > peak && !usage->peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+	}
+}
+
+gb_internal gb_inline void memory_tag_add(MemoryTag tag, isize size) {
+	if (global_memory_tags_enabled) {
+		memory_tag_update(tag, size);
+	}
+}
+
+gb_internal isize malloc_heap_in_use(void) {
+#if defined(GB_SYSTEM_LINUX) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+	struct mallinfo2 info = mallinfo2();
+	return cast(isize)(info.uordblks + info.hblkhd);
+#elif defined(GB_SYSTEM_OSX)
+	return cast(isize)mstats().bytes_used;
+#else
+	return 0;
+#endif
+}
+
+gb_internal void memory_tags_sample(void) {
+	if (global_memory_tags_enabled) {
+		MemoryTagUsage *usage = &global_memory_tags[MemoryTag_MallocHeap];
+		isize current = malloc_heap_in_use();
+		usage->current.store(current, std::memory_order_relaxed);
+		if (current > usage->peak.load(std::memory_order_relaxed)) {
+			usage->peak.store(current, std::memory_order_relaxed);
+		}
+	}
+}
+
+gb_internal void memory_tags_reset_peaks(void) {
+	for (MemoryTagUsage &usage : global_memory_tags) {
+		usage.peak.store(usage.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
+
+
 struct MemoryBlock {
 	MemoryBlock *prev;
 	u8 *         base; 
 	isize        size;
 	isize        used;
+	MemoryTag    tag;
 };
 
 struct Arena {
@@ -48,13 +132,14 @@ struct Arena {
 	// BlockingMutex mutex;
 	isize         temp_count;
 	Thread *      parent_thread;
+	MemoryTag     tag;
 };
 
 enum { DEFAULT_MINIMUM_BLOCK_SIZE = 8ll*1024ll*1024ll };
 
 gb_global isize DEFAULT_PAGE_SIZE = 4096;
 
-gb_internal MemoryBlock *virtual_memory_alloc(isize size);
+gb_internal MemoryBlock *virtual_memory_alloc(isize size, MemoryTag tag);
 gb_internal void virtual_memory_dealloc(MemoryBlock *block);
 gb_internal void *arena_alloc(Arena *arena, isize min_size, isize alignment);
 gb_internal void arena_free_all(Arena *arena);
@@ -78,6 +163,9 @@ gb_internal void thread_init_arenas(Thread *t) {
 
 	t->permanent_arena->minimum_block_size = DEFAULT_MINIMUM_BLOCK_SIZE;
 	t->temporary_arena->minimum_block_size = DEFAULT_MINIMUM_BLOCK_SIZE;
+
+	t->permanent_arena->tag = MemoryTag_PermanentArena;
+	t->temporary_arena->tag = MemoryTag_TemporaryArena;
 }
 
 gb_internal void *arena_alloc(Arena *arena, isize min_size, isize alignment) {
@@ -95,7 +183,7 @@ gb_internal void *arena_alloc(Arena *arena, isize min_size, isize alignment) {
 		
 		isize block_size = gb_max(size, arena->minimum_block_size);
 		
-		MemoryBlock *new_block = virtual_memory_alloc(block_size);
+		MemoryBlock *new_block = virtual_memory_alloc(block_size, arena->tag);
 		new_block->prev = arena->curr_block;
 		arena->curr_block = new_block;
 	}
@@ -201,7 +289,7 @@ gb_internal void platform_virtual_memory_protect(void *memory, isize size);
 	}
 #endif
 
-gb_internal MemoryBlock *virtual_memory_alloc(isize size) {
+gb_internal MemoryBlock *virtual_memory_alloc(isize size, MemoryTag tag) {
 	isize const page_size = DEFAULT_PAGE_SIZE; 
 	
 	isize total_size     = size + gb_size_of(PlatformMemoryBlock);
@@ -230,7 +318,9 @@ gb_internal MemoryBlock *virtual_memory_alloc(isize size) {
 	}
 	
 	pmblock->block.size = size;
+	pmblock->block.tag  = tag;
 	pmblock->total_size = total_size;
+	memory_tag_update(tag, size);
 
 	PlatformMemoryBlock *sentinel = &global_platform_memory_block_sentinel;
 	mutex_lock(&global_memory_block_mutex);
@@ -246,6 +336,8 @@ gb_internal MemoryBlock *virtual_memory_alloc(isize size) {
 gb_internal void virtual_memory_dealloc(MemoryBlock *block_to_free) {
 	PlatformMemoryBlock *block = cast(PlatformMemoryBlock *)block_to_free;
 	if (block != nullptr) {
+		memory_tag_update(block->block.tag, -block->block.size);
+
 		mutex_lock(&global_memory_block_mutex);
 		block->prev->next = block->next;
 		block->next->prev = block->prev;
@@ -379,8 +471,8 @@ enum ThreadArenaKind : uintptr {
 	ThreadArena_Temporary,
 };
 
-gb_global Arena default_permanent_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE};
-gb_global Arena default_temporary_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE};
+gb_global Arena default_permanent_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE, 0, nullptr, MemoryTag_PermanentArena};
+gb_global Arena default_temporary_arena = {nullptr, DEFAULT_MINIMUM_BLOCK_SIZE, 0, nullptr, MemoryTag_TemporaryArena};
 
 
 gb_internal Arena *get_arena(ThreadArenaKind kind) {
@@ -602,6 +694,46 @@ gb_internal GB_ALLOCATOR_PROC(heap_allocator_proc) {
 }
 
 
+gb_internal isize heap_block_size(void *ptr) {
+#if defined(GB_COMPILER_MSVC)
+	return cast(isize)HeapSize(GetProcessHeap(), 0, ptr);
+#elif defined(GB_SYSTEM_LINUX)
+	return cast(isize)malloc_usable_size(ptr);
+#elif defined(GB_SYSTEM_OSX)
+	return cast(isize)malloc_size(ptr);
+#else
+	gb_unused(ptr);
+	return 0;
+#endif
+}
+
+gb_internal GB_ALLOCATOR_PROC(tagged_heap_allocator_proc) {
+	if (!global_memory_tags_enabled) {
+		return heap_allocator_proc(nullptr, type, size, alignment, old_memory, old_size, flags);
+	}
+	MemoryTag tag = cast(MemoryTag)cast(uintptr)allocator_data;
+
+	isize before = 0;
+	if (old_memory != nullptr && (type == gbAllocation_Free || type == gbAllocation_Resize)) {
+		before = heap_block_size(old_memory);
+	}
+	void *ptr = heap_allocator_proc(nullptr, type, size, alignment, old_memory, old_size, flags);
+	isize after = ptr != nullptr ? heap_block_size(ptr) : 0;
+	if (after != before) {
+		memory_tag_update(tag, after - before);
+	}
+	return ptr;
+}
+
+// NOTE: the heap allocator, accounting for what it allocates under `tag` when timings are shown
+gb_internal gbAllocator tagged_heap_allocator(MemoryTag tag) {
+	gbAllocator a;
+	a.proc = tagged_heap_allocator_proc;
+	a.data = cast(void *)cast(uintptr)tag;
+	return a;
+}
+
+
 template <typename T>
 gb_internal isize resize_array_raw(T **array, gbAllocator const &a, isize old_count, isize new_count, isize custom_alignment=1) {
 	GB_ASSERT(new_count >= 0);
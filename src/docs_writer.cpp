@@ -18,6 +18,15 @@ gb_global char const* OdinDocWriterState_strings[] {
 
 gb_global std::atomic<bool> g_in_doc_writer;
 
+// NOTE: Rendering strings and hashing types is independent of the layout of the file, so it is
+// done up front on the thread pool and shared between the preparing and writing passes
+struct OdinDocRenderCache {
+	PtrMap<Type *,         u64>    type_hashes;
+	PtrMap<Ast *,          String> exprs;
+	PtrMap<CommentGroup *, String> comment_groups;
+	PtrMap<Entity *,       String> constant_values;
+};
+
 struct OdinDocWriter {
 	CheckerInfo *info;
 	OdinDocWriterState state;
@@ -40,11 +49,27 @@ struct OdinDocWriter {
 
 	OdinDocWriterItemTracker<u8> strings;
 	OdinDocWriterItemTracker<u8> blob;
+
+	OdinDocRenderCache render_cache;
 };
 
 gb_internal OdinDocEntityIndex odin_doc_add_entity(OdinDocWriter *w, Entity *e);
 gb_internal OdinDocTypeIndex odin_doc_type(OdinDocWriter *w, Type *type, bool cache);
 
+gb_internal void odin_doc_render_cache_init(OdinDocRenderCache *c, isize capacity) {
+	map_init(&c->type_hashes,     capacity);
+	map_init(&c->exprs,           capacity);
+	map_init(&c->comment_groups,  capacity);
+	map_init(&c->constant_values, capacity);
+}
+
+gb_internal void odin_doc_render_cache_destroy(OdinDocRenderCache *c) {
+	map_destroy(&c->type_hashes);
+	map_destroy(&c->exprs);
+	map_destroy(&c->comment_groups);
+	map_destroy(&c->constant_values);
+}
+
 template <typename T>
 gb_internal void odin_doc_writer_item_tracker_init(OdinDocWriterItemTracker<T> *t, isize size) {
 	t->len = size;
@@ -63,6 +88,8 @@ gb_internal void odin_doc_writer_prepare(OdinDocWriter *w) {
 	map_init(&w->entity_cache,      1<<18);
 	map_init(&w->type_cache,        1<<18);
 
+	odin_doc_render_cache_init(&w->render_cache, 1<<16);
+
 	odin_doc_writer_item_tracker_init(&w->files,    1);
 	odin_doc_writer_item_tracker_init(&w->pkgs,     1);
 	odin_doc_writer_item_tracker_init(&w->entities, 1);
@@ -81,6 +108,7 @@ gb_internal void odin_doc_writer_destroy(OdinDocWriter *w) {
 	map_destroy(&w->pkg_cache);
 	map_destroy(&w->entity_cache);
 	map_destroy(&w->type_cache);
+	odin_doc_render_cache_destroy(&w->render_cache);
 }
 
 
@@ -383,20 +411,24 @@ gb_internal OdinDocString odin_doc_pkg_doc_string(OdinDocWriter *w, AstPackage *
 	return odin_doc_write_string_without_cache(w, make_string(buf.data, buf.count));
 }
 
-gb_internal OdinDocString odin_doc_comment_group_string(OdinDocWriter *w, CommentGroup *g) {
-	if (g == nullptr) {
-		return {};
+gb_internal String odin_doc_render_comment_group(OdinDocRenderCache *c, CommentGroup *g) {
+	String *found = map_get(&c->comment_groups, g);
+	if (found) {
+		return *found;
 	}
 	auto buf = array_make<u8>(permanent_allocator(), 0, 0); // Minor leak
 
 	odin_doc_append_comment_group_string(&buf, g);
 
-	return odin_doc_write_string_without_cache(w, make_string(buf.data, buf.count));
+	String str = make_string(buf.data, buf.count);
+	map_set(&c->comment_groups, g, str);
+	return str;
 }
 
-gb_internal OdinDocString odin_doc_expr_string(OdinDocWriter *w, Ast *expr) {
-	if (expr == nullptr) {
-		return {};
+gb_internal String odin_doc_render_expr(OdinDocRenderCache *c, Ast *expr) {
+	String *found = map_get(&c->exprs, expr);
+	if (found) {
+		return *found;
 	}
 	gbString s = write_expr_to_string( // Minor leak
 		gb_string_make(permanent_allocator(), ""),
@@ -404,7 +436,54 @@ gb_internal OdinDocString odin_doc_expr_string(OdinDocWriter *w, Ast *expr) {
 		build_context.cmd_doc_flags & CmdDocFlag_Short
 	);
 
-	return odin_doc_write_string(w, make_string(cast(u8 *)s, gb_string_length(s)));
+	String str = make_string(cast(u8 *)s, gb_string_length(s));
+	map_set(&c->exprs, expr, str);
+	return str;
+}
+
+gb_internal String odin_doc_render_constant_value(OdinDocRenderCache *c, Entity *e) {
+	GB_ASSERT(e->kind == Entity_Constant);
+	String *found = map_get(&c->constant_values, e);
+	if (found) {
+		return *found;
+	}
+	String str = make_string_c(exact_value_to_string(e->Constant.value));
+	map_set(&c->constant_values, e, str);
+	return str;
+}
+
+gb_internal Type *odin_doc_resolve_type_alias(Type *type) {
+	if (type != nullptr && type->kind == Type_Named) {
+		Entity *e = type->Named.type_name;
+		if (e->TypeName.is_type_alias) {
+			return type->Named.base;
+		}
+	}
+	return type;
+}
+
+gb_internal u64 odin_doc_render_type_hash(OdinDocRenderCache *c, Type *type) {
+	u64 *found = map_get(&c->type_hashes, type);
+	if (found) {
+		return *found;
+	}
+	u64 hash = type_hash_canonical_type(type);
+	map_set(&c->type_hashes, type, hash);
+	return hash;
+}
+
+gb_internal OdinDocString odin_doc_comment_group_string(OdinDocWriter *w, CommentGroup *g) {
+	if (g == nullptr) {
+		return {};
+	}
+	return odin_doc_write_string_without_cache(w, odin_doc_render_comment_group(&w->render_cache, g));
+}
+
+gb_internal OdinDocString odin_doc_expr_string(OdinDocWriter *w, Ast *expr) {
+	if (expr == nullptr) {
+		return {};
+	}
+	return odin_doc_write_string(w, odin_doc_render_expr(&w->render_cache, expr));
 }
 
 gb_internal OdinDocArray<OdinDocAttribute> odin_doc_attributes(OdinDocWriter *w, Array<Ast *> const &attributes) {
@@ -484,16 +563,11 @@ gb_internal OdinDocTypeIndex odin_doc_type(OdinDocWriter *w, Type *type, bool ca
 		return 0;
 	}
 
-	if (type->kind == Type_Named) {
-		Entity *e = type->Named.type_name;
-		if (e->TypeName.is_type_alias) {
-			type = type->Named.base;
-		}
-	}
+	type = odin_doc_resolve_type_alias(type);
 
 	u64 type_hash = {0};
 	if (cache) {
-		type_hash = type_hash_canonical_type(type);
+		type_hash = odin_doc_render_type_hash(&w->render_cache, type);
 		OdinDocTypeIndex *found = map_get(&w->type_cache, type_hash);
 		if (found) {
 			return *found;
@@ -834,11 +908,11 @@ gb_internal OdinDocEntityIndex odin_doc_add_entity(OdinDocWriter *w, Entity *e)
 
 		if (e->Variable.is_foreign) { flags |= OdinDocEntityFlag_Foreign; }
 		if (e->Variable.is_export)  { flags |= OdinDocEntityFlag_Export;  }
-		if (e->Variable.thread_local_model != "") {
+		if (entity_cold(e)->thread_local_model != "") {
 			flags |= OdinDocEntityFlag_Var_Thread_Local;
 		}
 		if (e->flags & EntityFlag_Static) { flags |= OdinDocEntityFlag_Var_Static; }
-		link_name = e->Variable.link_name;
+		link_name = entity_cold(e)->link_name;
 		if (init_expr == nullptr) {
 			init_expr = e->Variable.init_expr;
 		}
@@ -898,7 +972,7 @@ gb_internal OdinDocEntityIndex odin_doc_add_entity(OdinDocWriter *w, Entity *e)
 			} else if (e->Constant.param_value.original_ast_expr) {
 				init_string = odin_doc_expr_string(w, e->Constant.param_value.original_ast_expr);
 			} else {
-				init_string = odin_doc_write_string(w, make_string_c(exact_value_to_string(e->Constant.value)));
+				init_string = odin_doc_write_string(w, odin_doc_render_constant_value(&w->render_cache, e));
 			}
 		} else if (e->kind == Entity_Variable) {
 			if (e->Variable.param_value.original_ast_expr) {
@@ -962,7 +1036,7 @@ gb_internal void odin_doc_update_entities(OdinDocWriter *w) {
 			if (w->state == OdinDocWriterState_Writing) {
 				GB_ASSERT(type_index != 0);
 			}
-			foreign_library = odin_doc_add_entity(w, e->Variable.foreign_library);
+			foreign_library = odin_doc_add_entity(w, entity_cold(e)->foreign_library);
 			break;
 		case Entity_Procedure:
 			foreign_library = odin_doc_add_entity(w, e->Procedure.foreign_library);
@@ -1001,6 +1075,35 @@ gb_internal void odin_doc_update_entities(OdinDocWriter *w) {
 
 
 
+gb_internal bool odin_doc_is_pkg_entry(AstPackage *pkg, Entity *e) {
+	switch (e->kind) {
+	case Entity_Invalid:
+	case Entity_Nil:
+	case Entity_Label:
+		return false;
+	case Entity_Constant:
+	case Entity_Variable:
+	case Entity_TypeName:
+	case Entity_Procedure:
+	case Entity_ProcGroup:
+	case Entity_ImportName:
+	case Entity_LibraryName:
+	case Entity_Builtin:
+		// Fine
+		break;
+	}
+	if (e->pkg != pkg) {
+		return false;
+	}
+	if (!is_entity_exported(e, true)) {
+		return false;
+	}
+	if (e->token.string.len == 0) {
+		return false;
+	}
+	return true;
+}
+
 gb_internal OdinDocArray<OdinDocScopeEntry> odin_doc_add_pkg_entries(OdinDocWriter *w, AstPackage *pkg) {
 	if (pkg->scope == nullptr) {
 		return {};
@@ -1017,29 +1120,7 @@ gb_internal OdinDocArray<OdinDocScopeEntry> odin_doc_add_pkg_entries(OdinDocWrit
 	for (auto const &element : pkg->scope->elements) {
 		String name = element.key;
 		Entity *e = element.value;
-		switch (e->kind) {
-		case Entity_Invalid:
-		case Entity_Nil:
-		case Entity_Label:
-			continue;
-		case Entity_Constant:
-		case Entity_Variable:
-		case Entity_TypeName:
-		case Entity_Procedure:
-		case Entity_ProcGroup:
-		case Entity_ImportName:
-		case Entity_LibraryName:
-		case Entity_Builtin:
-			// Fine
-			break;
-		}
-		if (e->pkg != pkg) {
-			continue;
-		}
-		if (!is_entity_exported(e, true)) {
-			continue;
-		}
-		if (e->token.string.len == 0) {
+		if (!odin_doc_is_pkg_entry(pkg, e)) {
 			continue;
 		}
 
@@ -1053,6 +1134,137 @@ gb_internal OdinDocArray<OdinDocScopeEntry> odin_doc_add_pkg_entries(OdinDocWrit
 }
 
 
+
+// Renders everything `odin_doc_add_entity` will need for `e` (and its fields or parameters)
+gb_internal void odin_doc_render_entity(OdinDocRenderCache *c, Entity *e, bool render_members) {
+	Ast *init_expr = nullptr;
+	CommentGroup *comment = nullptr;
+	CommentGroup *docs = nullptr;
+	if (e->decl_info != nullptr) {
+		init_expr = e->decl_info->init_expr;
+		comment = e->decl_info->comment;
+		docs = e->decl_info->docs;
+
+		for (Ast *attr : e->decl_info->attributes) {
+			if (attr->kind != Ast_Attribute) continue;
+			for (Ast *elem : attr->Attribute.elems) {
+				if (elem->kind == Ast_FieldValue && elem->FieldValue.value != nullptr) {
+					odin_doc_render_expr(c, elem->FieldValue.value);
+				}
+			}
+		}
+	}
+	if (e->kind == Entity_Variable) {
+		if (!comment)   { comment   = e->Variable.comment; }
+		if (!docs)      { docs      = e->Variable.docs; }
+		if (!init_expr) { init_expr = e->Variable.init_expr; }
+	} else if (e->kind == Entity_Constant) {
+		if (!comment)   { comment   = e->Constant.comment; }
+		if (!docs)      { docs      = e->Constant.docs; }
+	}
+
+	if (comment) { odin_doc_render_comment_group(c, comment); }
+	if (docs)    { odin_doc_render_comment_group(c, docs); }
+
+	if (init_expr) {
+		odin_doc_render_expr(c, init_expr);
+	} else if (e->kind == Entity_Constant) {
+		if (e->Constant.flags & EntityConstantFlag_ImplicitEnumValue) {
+			// Blank
+		} else if (e->Constant.param_value.original_ast_expr) {
+			odin_doc_render_expr(c, e->Constant.param_value.original_ast_expr);
+		} else {
+			odin_doc_render_constant_value(c, e);
+		}
+	} else if (e->kind == Entity_Variable) {
+		if (e->Variable.param_value.original_ast_expr) {
+			odin_doc_render_expr(c, e->Variable.param_value.original_ast_expr);
+		}
+	}
+
+	Type *type = odin_doc_resolve_type_alias(e->type);
+	if (type == nullptr || is_type_untyped(default_type(type))) {
+		return;
+	}
+	odin_doc_render_type_hash(c, type);
+
+	if (!render_members) {
+		return;
+	}
+
+	Type *bt = base_type(type);
+	switch (e->kind) {
+	case Entity_TypeName:
+		switch (bt->kind) {
+		case Type_Struct:
+			for (Entity *f : bt->Struct.fields)   { odin_doc_render_entity(c, f, false); }
+			break;
+		case Type_Enum:
+			for (Entity *f : bt->Enum.fields)     { odin_doc_render_entity(c, f, false); }
+			break;
+		case Type_BitField:
+			for (Entity *f : bt->BitField.fields) { odin_doc_render_entity(c, f, false); }
+			break;
+		}
+		break;
+	case Entity_Procedure:
+		if (bt->kind == Type_Proc) {
+			if (bt->Proc.params)  { for (Entity *p : bt->Proc.params->Tuple.variables)  { odin_doc_render_entity(c, p, false); } }
+			if (bt->Proc.results) { for (Entity *p : bt->Proc.results->Tuple.variables) { odin_doc_render_entity(c, p, false); } }
+		}
+		break;
+	}
+}
+
+struct OdinDocRenderTask {
+	AstPackage *pkg;
+	OdinDocRenderCache cache;
+};
+
+gb_internal WORKER_TASK_PROC(odin_doc_render_pkg_worker_proc) {
+	OdinDocRenderTask *t = cast(OdinDocRenderTask *)data;
+	AstPackage *pkg = t->pkg;
+	for (auto const &element : pkg->scope->elements) {
+		Entity *e = element.value;
+		if (odin_doc_is_pkg_entry(pkg, e)) {
+			odin_doc_render_entity(&t->cache, e, true);
+		}
+	}
+	return 0;
+}
+
+gb_internal void odin_doc_render_pkgs(OdinDocWriter *w, Array<AstPackage *> const &pkgs) {
+	debugf("odin_doc_render_pkgs\n");
+
+	auto tasks = array_make<OdinDocRenderTask>(heap_allocator(), 0, pkgs.count);
+	defer (array_free(&tasks));
+
+	for (AstPackage *pkg : pkgs) {
+		if (pkg->scope == nullptr) {
+			continue;
+		}
+		OdinDocRenderTask task = {};
+		task.pkg = pkg;
+		odin_doc_render_cache_init(&task.cache, pkg->scope->elements.count);
+		array_add(&tasks, task);
+	}
+
+	for (OdinDocRenderTask &task : tasks) {
+		thread_pool_add_task(odin_doc_render_pkg_worker_proc, &task);
+	}
+	thread_pool_wait();
+
+	// NOTE: merged in package order; a key rendered by several packages has the same value in each
+	OdinDocRenderCache *c = &w->render_cache;
+	for (OdinDocRenderTask &task : tasks) {
+		for (auto const &entry : task.cache.type_hashes)     { map_set(&c->type_hashes,     entry.key, entry.value); }
+		for (auto const &entry : task.cache.exprs)           { map_set(&c->exprs,           entry.key, entry.value); }
+		for (auto const &entry : task.cache.comment_groups)  { map_set(&c->comment_groups,  entry.key, entry.value); }
+		for (auto const &entry : task.cache.constant_values) { map_set(&c->constant_values, entry.key, entry.value); }
+		odin_doc_render_cache_destroy(&task.cache);
+	}
+}
+
 gb_internal void odin_doc_write_docs(OdinDocWriter *w) {
 	debugf("odin_doc_write_docs %s", w->state ? "preparing" : "writing");
 
@@ -1074,6 +1286,10 @@ gb_internal void odin_doc_write_docs(OdinDocWriter *w) {
 	debugf("odin_doc_update_entities sort pkgs %s\n", w->state ? "preparing" : "writing");
 	array_sort(pkgs, cmp_ast_package_by_name);
 
+	if (w->state == OdinDocWriterState_Preparing) {
+		odin_doc_render_pkgs(w, pkgs);
+	}
+
 	for_array(i, pkgs) {
 		gbAllocator allocator = heap_allocator();
 
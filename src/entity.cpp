@@ -131,6 +131,15 @@ enum EntityConstantFlags : u32 {
 	EntityConstantFlag_ImplicitEnumValue = 1<<0,
 };
 
+// NOTE: Whether a local variable declared without a value must be zeroed at its declaration.
+// The checker elides the zeroing when the variable is wholly assigned on every path before any other reference,
+// see `check_zero_init_of_locals`.
+enum VariableZeroInit : u8 {
+	VariableZeroInit_Required,
+	VariableZeroInit_Pending,
+	VariableZeroInit_Elided,
+};
+
 enum ProcedureOptimizationMode : u8 {
 	ProcedureOptimizationMode_Default,
 	ProcedureOptimizationMode_None,
@@ -159,25 +168,46 @@ gb_internal TypeNameObjCMetadata *create_type_name_obj_c_metadata() {
 }
 
 // An Entity is a named "thing" in the language
+// NOTE: Data which few entities carry (attributes, `using` fields, variable linkage) lives out of
+// line so that the entity header and per-kind payload stay within as few cache lines as possible
+struct EntityCold {
+	String  deprecated_message;
+	String  warning_message;
+	Ast *   using_expr;
+
+	// Entity_Variable linkage
+	String  thread_local_model;
+	Entity *foreign_library;
+	Ast *   foreign_library_ident;
+	String  link_name;
+	String  link_prefix;
+	String  link_suffix;
+	String  link_section;
+};
+
 struct Entity {
+	// NOTE: Fields up to `identifier` are the ones the dependency, minimum dependency and scope
+	// passes touch, keep them within the first cache line
 	EntityKind  kind;
-	u64         id;
-	std::atomic<u64>         flags;
 	std::atomic<EntityState> state;
-	Token       token;
-	Scope *     scope;
+	std::atomic<u64>         flags;
+	u64         id;
 	Type *      type;
-	std::atomic<Ast *> identifier; // Can be nullptr
 	DeclInfo *  decl_info;
+	Scope *     scope;
+	std::atomic<Ast *> identifier; // Can be nullptr
 	DeclInfo *  parent_proc_decl; // nullptr if in file/global scope
 	AstFile *   file;
 	AstPackage *pkg;
+	Token       token;
 
 	// TODO(bill): Cleanup how `using` works for entities
 	Entity *    using_parent;
-	Ast *       using_expr;
 
 	Entity *    aliased_of;
+	u64         order_in_src;
+
+	std::atomic<EntityCold *> cold; // see entity_cold and entity_make_cold
 
 	union {
 		struct lbModule *code_gen_module;
@@ -188,10 +218,6 @@ struct Entity {
 		struct cgProcedure *cg_procedure;
 	};
 
-	u64         order_in_src;
-	String      deprecated_message;
-	String      warning_message;
-
 	// IMPORTANT NOTE(bill): This must be a discriminated union because of patching
 	// later entity kinds
 	union {
@@ -217,19 +243,14 @@ struct Entity {
 
 			Type *for_loop_parent_type;
 
-			String     thread_local_model;
-			Entity *   foreign_library;
-			Ast *      foreign_library_ident;
-			String     link_name;
-			String     link_prefix;
-			String     link_suffix;
-			String     link_section;
 			CommentGroup *docs;
 			CommentGroup *comment;
 			bool       is_foreign;
 			bool       is_export;
 			bool       is_global;
 			bool       is_rodata;
+			VariableZeroInit zero_init;
+			i32        zero_init_uses; // uses not yet accounted for by `check_zero_init_of_locals`
 		} Variable;
 		struct {
 			Type * type_parameter_specialization;
@@ -336,10 +357,36 @@ gb_internal bool entity_has_deferred_procedure(Entity *e) {
 
 
 gb_global std::atomic<u64> global_entity_id;
+gb_global std::atomic<isize> global_entity_kind_counts[Entity_Count];
+gb_global std::atomic<isize> global_entity_cold_count;
+
+gb_global EntityCold const entity_cold_empty = {};
+
+// NOTE: read-only view of the out-of-line data, never allocates
+gb_internal EntityCold const *entity_cold(Entity *e) {
+	EntityCold *cold = e->cold.load(std::memory_order_acquire);
+	return cold ? cold : &entity_cold_empty;
+}
+
+gb_internal EntityCold *entity_make_cold(Entity *e) {
+	EntityCold *cold = e->cold.load(std::memory_order_acquire);
+	if (cold != nullptr) {
+		return cold;
+	}
+	EntityCold *new_cold = gb_alloc_item(permanent_allocator(), EntityCold);
+	if (e->cold.compare_exchange_strong(cold, new_cold, std::memory_order_acq_rel)) {
+		global_entity_cold_count.fetch_add(1, std::memory_order_relaxed);
+		memory_tag_add(MemoryTag_Entity, gb_size_of(EntityCold));
+		return new_cold;
+	}
+	return cold;
+}
 
 gb_internal Entity *alloc_entity(EntityKind kind, Scope *scope, Token token, Type *type) {
 	gbAllocator a = permanent_allocator();
 	Entity *entity = gb_alloc_item(a, Entity);
+	global_entity_kind_counts[kind].fetch_add(1, std::memory_order_relaxed);
+	memory_tag_add(MemoryTag_Entity, gb_size_of(Entity));
 	entity->kind   = kind;
 	entity->state  = EntityState_Unresolved;
 	entity->scope  = scope;
@@ -364,7 +411,7 @@ gb_internal Entity *alloc_entity_using_variable(Entity *parent, Token token, Typ
 	Entity *entity = alloc_entity(Entity_Variable, parent->scope, token, type);
 	entity->using_parent = parent;
 	entity->parent_proc_decl = parent->parent_proc_decl;
-	entity->using_expr = using_expr;
+	entity_make_cold(entity)->using_expr = using_expr;
 	entity->flags |= EntityFlag_Using;
 	entity->flags |= EntityFlag_Used;
 	entity->state = EntityState_Resolved;
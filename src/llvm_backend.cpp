@@ -267,6 +267,9 @@ gb_internal lbValue lb_equal_proc_for_type(lbModule *m, Type *type) {
 	LLVMSetLinkage(p->value, LLVMInternalLinkage);
 	// lb_add_attribute_to_proc(m, p->value, "readonly");
 	lb_add_attribute_to_proc(m, p->value, "nounwind");
+	if (type_size_of(type) <= LB_INLINE_MEMORY_EQUAL_MAX_BYTES) {
+		lb_add_attribute_to_proc(m, p->value, "inlinehint");
+	}
 
 	LLVMValueRef x = LLVMGetParam(p->value, 0);
 	LLVMValueRef y = LLVMGetParam(p->value, 1);
@@ -288,7 +291,11 @@ gb_internal lbValue lb_equal_proc_for_type(lbModule *m, Type *type) {
 
 	lb_start_block(p, block_diff_ptr);
 
-	if (type->kind == Type_Struct) {
+	if (is_type_simple_compare(type) && 0 < type_size_of(type) && type_size_of(type) <= LB_INLINE_MEMORY_EQUAL_MAX_BYTES) {
+		lbValue ok = lb_emit_inline_memory_equal(p, Token_CmpEq, lhs, rhs, type_size_of(type));
+		ok = lb_emit_conv(p, ok, t_bool);
+		LLVMBuildRet(p->builder, ok.value);
+	} else if (type->kind == Type_Struct) {
 		type_set_offsets(type);
 
 		lbBlock *block_false = lb_create_block(p, "bfalse");
@@ -394,11 +401,73 @@ gb_internal lbValue lb_equal_proc_for_type(lbModule *m, Type *type) {
 	return {compare_proc->value, compare_proc->type};
 }
 
+// NOTE: These mirror `runtime.default_hasher` (FNV-1a over the bytes of the key) and must produce the same values
+gb_internal lbValue lb_hash_begin(lbProcedure *p, lbValue seed) {
+	lbValue h = lb_emit_conv(p, seed, t_u64);
+	return lb_emit_arith(p, Token_Add, h, lb_const_int(p->module, t_u64, 0xcbf29ce484222325ull), t_u64);
+}
+
+gb_internal lbValue lb_hash_byte(lbProcedure *p, lbValue h, lbValue byte) {
+	h = lb_emit_arith(p, Token_Xor, h, byte, t_u64);
+	return lb_emit_arith(p, Token_Mul, h, lb_const_int(p->module, t_u64, 0x100000001b3ull), t_u64);
+}
+
+gb_internal lbValue lb_hash_end(lbProcedure *p, lbValue h) {
+	lbModule *m = p->module;
+	u64 hash_mask = (1ull << (8*build_context.ptr_size - 1)) - 1;
+	h = lb_emit_arith(p, Token_And, h, lb_const_int(m, t_u64, hash_mask), t_u64);
+	lbValue res = lb_emit_conv(p, h, t_uintptr);
+	lbValue is_zero = lb_emit_comp(p, Token_CmpEq, res, lb_const_int(m, t_uintptr, 0));
+	return lb_emit_arith(p, Token_Or, res, lb_emit_conv(p, is_zero, t_uintptr), t_uintptr);
+}
+
+enum {LB_INLINE_HASH_MAX_BYTES = 32};
+
+// NOTE: Hashes `size` bytes at `data` a word at a time: each word is loaded once and its bytes are extracted in
+// memory order, which keeps the byte-serial FNV-1a values of the runtime
+gb_internal lbValue lb_inline_hash_bytes(lbProcedure *p, lbValue data, i64 size, lbValue seed) {
+	lbModule *m = p->module;
+	GB_ASSERT(build_context.endian_kind != TargetEndian_Big);
+
+	data = lb_emit_conv(p, data, t_u8_ptr);
+	lbValue h = lb_hash_begin(p, seed);
+	for (i64 offset = 0; offset < size; /**/) {
+		i64 n = 8;
+		while (n > size-offset) {
+			n >>= 1;
+		}
+		LLVMTypeRef word_type = LLVMIntTypeInContext(m->ctx, cast(unsigned)(8*n));
+		lbValue ptr = lb_emit_ptr_offset(p, data, lb_const_int(m, t_int, offset));
+		LLVMValueRef word_ptr = LLVMBuildPointerCast(p->builder, ptr.value, LLVMPointerType(word_type, 0), "");
+		LLVMValueRef word = LLVMBuildLoad2(p->builder, word_type, word_ptr, "");
+		LLVMSetAlignment(word, 1);
+		word = LLVMBuildZExtOrBitCast(p->builder, word, lb_type(m, t_u64), "");
+
+		for (i64 i = 0; i < n; i++) {
+			LLVMValueRef byte = word;
+			if (i != 0) {
+				byte = LLVMBuildLShr(p->builder, byte, LLVMConstInt(lb_type(m, t_u64), cast(u64)(8*i), false), "");
+			}
+			if (n != 1) {
+				byte = LLVMBuildAnd(p->builder, byte, LLVMConstInt(lb_type(m, t_u64), 0xff, false), "");
+			}
+			h = lb_hash_byte(p, h, {byte, t_u64});
+		}
+		offset += n;
+	}
+	return lb_hash_end(p, h);
+}
+
 gb_internal lbValue lb_simple_compare_hash(lbProcedure *p, Type *type, lbValue data, lbValue seed) {
 	TEMPORARY_ALLOCATOR_GUARD();
 
 	GB_ASSERT_MSG(is_type_simple_compare(type), "%s", type_to_string(type));
 
+	i64 size = type_size_of(type);
+	if (size <= LB_INLINE_HASH_MAX_BYTES && build_context.endian_kind != TargetEndian_Big) {
+		return lb_inline_hash_bytes(p, data, size, seed);
+	}
+
 	auto args = array_make<lbValue>(temporary_allocator(), 3);
 	args[0] = data;
 	args[1] = seed;
@@ -442,7 +511,9 @@ gb_internal lbValue lb_hasher_proc_for_type(lbModule *m, Type *type) {
 
 	if (is_type_simple_compare(type)) {
 		lbValue res = lb_simple_compare_hash(p, type, data, seed);
-		lb_add_callsite_force_inline(p, res);
+		if (LLVMIsACallInst(res.value)) {
+			lb_add_callsite_force_inline(p, res);
+		}
 		LLVMBuildRet(p->builder, res.value);
 		return {p->value, p->type};
 	}
@@ -458,12 +529,25 @@ gb_internal lbValue lb_hasher_proc_for_type(lbModule *m, Type *type) {
 			GB_ASSERT(type->Struct.offsets != nullptr);
 			i64 offset = type->Struct.offsets[i];
 			Entity *field = type->Struct.fields[i];
-			lbValue field_hasher = lb_hasher_proc_for_type(m, field->type);
 			lbValue ptr = lb_emit_ptr_offset(p, data, lb_const_int(m, t_uintptr, offset));
+			if (is_type_simple_compare(field->type)) {
+				// NOTE: Same value as calling the field's hasher, which is `default_hasher` over its bytes
+				seed = lb_simple_compare_hash(p, field->type, ptr, seed);
+				if (LLVMIsACallInst(seed.value)) {
+					lb_add_callsite_force_inline(p, seed);
+				}
+				continue;
+			}
 
+			lbValue field_hasher = lb_hasher_proc_for_type(m, field->type);
 			args[0] = ptr;
 			args[1] = seed;
 			seed = lb_emit_call(p, field_hasher, args);
+
+			Type *ft = core_type(field->type);
+			if (ft->kind != Type_Struct && ft->kind != Type_Union && ft->kind != Type_Array && ft->kind != Type_EnumeratedArray) {
+				lb_add_callsite_force_inline(p, seed);
+			}
 		}
 		LLVMBuildRet(p->builder, seed.value);
 	} else if (type->kind == Type_Union)  {
@@ -991,51 +1075,114 @@ gb_internal lbValue lb_gen_map_info_ptr(lbModule *m, Type *map_type) {
 	return addr.addr;
 }
 
-gb_internal lbValue lb_const_hash(lbModule *m, lbValue key, Type *key_type) {
-	if (true) {
+gb_internal bool lb_const_string_bytes(LLVMValueRef ptr, char const **text_, isize *length_) {
+	*text_ = nullptr;
+	*length_ = 0;
+	if (ptr == nullptr || LLVMIsNull(ptr)) {
+		return false;
+	}
+	if (LLVMIsAConstantExpr(ptr) && LLVMGetConstOpcode(ptr) == LLVMGetElementPtr) {
+		unsigned n = cast(unsigned)LLVMGetNumOperands(ptr);
+		for (unsigned i = 1; i < n; i++) {
+			LLVMValueRef idx = LLVMGetOperand(ptr, i);
+			if (!LLVMIsAConstantInt(idx) || LLVMConstIntGetZExtValue(idx) != 0) {
+				return false;
+			}
+		}
+		ptr = LLVMGetOperand(ptr, 0);
+	}
+	if (!LLVMIsAGlobalVariable(ptr) || !LLVMIsGlobalConstant(ptr)) {
+		return false;
+	}
+	LLVMValueRef init = LLVMGetInitializer(ptr);
+	if (init == nullptr || !LLVMIsAConstantDataSequential(init) || !LLVMIsConstantString(init)) {
+		return false;
+	}
+	size_t length = 0;
+	*text_ = LLVMGetAsString(init, &length);
+	*length_ = cast(isize)length;
+	return true;
+}
+
+// NOTE: The runtime hashers are FNV-1a over the bytes of the key, seeded per map. A constant key cannot be hashed
+// completely at compile time because of the seed, but its bytes can be folded into straight-line code, which removes
+// the call to the hasher and every load of the key.
+gb_internal lbValue lb_const_hash(lbProcedure *p, lbValue key, Type *key_type, lbValue seed) {
+	lbModule *m = p->module;
+	if (key.value == nullptr || !LLVMIsConstant(key.value)) {
 		return {};
 	}
 
-	lbValue hashed_key = {};
-
-#if 0
-	if (lb_is_const(key)) {
-		u64 hash = 0xcbf29ce484222325;
-		if (is_type_cstring(key_type)) {
-			size_t length = 0;
-			char const *text = LLVMGetAsString(key.value, &length);
-			hash = fnv64a(text, cast(isize)length);
-		} else if (is_type_string(key_type)) {
-			unsigned data_indices[] = {0};
-			unsigned len_indices[] = {1};
-			LLVMValueRef data = LLVMConstExtractValue(key.value, data_indices, gb_count_of(data_indices));
-			LLVMValueRef len  = LLVMConstExtractValue(key.value, len_indices,  gb_count_of(len_indices));
-			i64 length = LLVMConstIntGetSExtValue(len);
+	u8 buf[LB_INLINE_HASH_MAX_BYTES] = {};
+	u8 const *bytes = buf;
+	i64 count = 0;
+
+	key_type = core_type(key_type);
+	if (is_type_cstring(key_type)) {
+		if (LLVMIsNull(key.value)) {
+			count = 0;
+		} else {
 			char const *text = nullptr;
-			if (false && length != 0) {
-			if (LLVMGetConstOpcode(data) != LLVMGetElementPtr) {
+			isize length = 0;
+			if (!lb_const_string_bytes(key.value, &text, &length)) {
+				return {};
+			}
+			while (count < length && text[count] != 0) {
+				count += 1;
+			}
+			if (count == length) {
+				return {};
+			}
+			bytes = cast(u8 const *)text;
+		}
+	} else if (is_type_string(key_type)) {
+		if (LLVMIsNull(key.value)) {
+			count = 0;
+		} else {
+			if (LLVMGetNumOperands(key.value) != 2) {
+				return {};
+			}
+			LLVMValueRef len = LLVMGetOperand(key.value, 1);
+			if (!LLVMIsAConstantInt(len)) {
+				return {};
+			}
+			count = LLVMConstIntGetSExtValue(len);
+			if (count < 0 || count > LB_INLINE_HASH_MAX_BYTES) {
+				return {};
+			} else if (count > 0) {
+				char const *text = nullptr;
+				isize length = 0;
+				if (!lb_const_string_bytes(LLVMGetOperand(key.value, 0), &text, &length) || length < count) {
 					return {};
 				}
-				// TODO(bill): THIS IS BROKEN! THIS NEEDS FIXING :P
-
-				size_t ulength = 0;
-				text = LLVMGetAsString(data, &ulength);
-				gb_printf_err("%lld %llu %s\n", length, ulength, text);
-				length = gb_min(length, cast(i64)ulength);
+				bytes = cast(u8 const *)text;
 			}
-			hash = fnv64a(text, cast(isize)length);
-		} else {
+		}
+	} else if (is_type_simple_compare(key_type) && LLVMIsAConstantInt(key.value)) {
+		if (build_context.endian_kind == TargetEndian_Big) {
 			return {};
 		}
-		// TODO(bill): other const hash types
-
-		if (build_context.word_size == 4) {
-			hash &= 0xffffffffull;
+		count = type_size_of(key_type);
+		if (count > 8 || LLVMGetIntTypeWidth(LLVMTypeOf(key.value)) > 64) {
+			return {};
+		}
+		u64 v = LLVMConstIntGetZExtValue(key.value);
+		for (i64 i = 0; i < count; i++) {
+			buf[i] = cast(u8)(v >> (8*i));
 		}
-		hashed_key = lb_const_int(m, t_uintptr, hash);
+	} else {
+		return {};
 	}
-#endif
-	return hashed_key;
+
+	if (count > LB_INLINE_HASH_MAX_BYTES) {
+		return {};
+	}
+
+	lbValue h = lb_hash_begin(p, seed);
+	for (i64 i = 0; i < count; i++) {
+		h = lb_hash_byte(p, h, lb_const_int(m, t_u64, bytes[i]));
+	}
+	return lb_hash_end(p, h);
 }
 
 gb_internal lbValue lb_gen_map_key_hash(lbProcedure *p, lbValue const &map_ptr, lbValue key, lbValue *key_ptr_) {
@@ -1050,17 +1197,17 @@ gb_internal lbValue lb_gen_map_key_hash(lbProcedure *p, lbValue const &map_ptr,
 
 	if (key_ptr_) *key_ptr_ = key_ptr;
 
-	lbValue hashed_key = lb_const_hash(p->module, real_key, key_type);
+	lbValue seed = {};
+	{
+		auto args = array_make<lbValue>(temporary_allocator(), 1);
+		args[0] = lb_map_data_uintptr(p, lb_emit_load(p, map_ptr));
+		seed = lb_emit_runtime_call(p, "map_seed_from_map_data", args);
+	}
+
+	lbValue hashed_key = lb_const_hash(p, real_key, key_type, seed);
 	if (hashed_key.value == nullptr) {
 		lbValue hasher = lb_hasher_proc_for_type(p->module, key_type);
 
-		lbValue seed = {};
-		{
-			auto args = array_make<lbValue>(temporary_allocator(), 1);
-			args[0] = lb_map_data_uintptr(p, lb_emit_load(p, map_ptr));
-			seed = lb_emit_runtime_call(p, "map_seed_from_map_data", args);
-		}
-
 		auto args = array_make<lbValue>(temporary_allocator(), 2);
 		args[0] = key_ptr;
 		args[1] = seed;
@@ -3199,13 +3346,13 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 		g.value = LLVMAddGlobal(m->mod, lb_type(m, e->type), alloc_cstring(permanent_allocator(), name));
 		g.type = alloc_type_pointer(e->type);
 
-		lb_apply_thread_local_model(g.value, e->Variable.thread_local_model);
+		lb_apply_thread_local_model(g.value, entity_cold(e)->thread_local_model);
 
 		if (is_foreign) {
 			LLVMSetLinkage(g.value, LLVMExternalLinkage);
 			LLVMSetDLLStorageClass(g.value, LLVMDLLImportStorageClass);
 			LLVMSetExternallyInitialized(g.value, true);
-			lb_add_foreign_library_path(m, e->Variable.foreign_library);
+			lb_add_foreign_library_path(m, entity_cold(e)->foreign_library);
 		} else {
 			LLVMSetInitializer(g.value, LLVMConstNull(lb_type(m, e->type)));
 		}
@@ -3218,8 +3365,8 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 		lb_set_linkage_from_entity_flags(m, g.value, e->flags);
 		LLVMSetAlignment(g.value, cast(u32)type_align_of(e->type));
 		
-		if (e->Variable.link_section.len > 0) {
-			LLVMSetSection(g.value, alloc_cstring(permanent_allocator(), e->Variable.link_section));
+		if (entity_cold(e)->link_section.len > 0) {
+			LLVMSetSection(g.value, alloc_cstring(permanent_allocator(), entity_cold(e)->link_section));
 		}
 
 		lbGlobalVariable var = {};
@@ -3234,7 +3381,7 @@ gb_internal bool lb_generate_code(lbGenerator *gen) {
 						auto cc = LB_CONST_CONTEXT_DEFAULT;
 						cc.is_rodata = e->kind == Entity_Variable && e->Variable.is_rodata;
 						cc.allow_local = false;
-						cc.link_section = e->Variable.link_section;
+						cc.link_section = entity_cold(e)->link_section;
 
 						ExactValue v = tav.value;
 						lbValue init = lb_const_value(m, tav.type, v, cc);
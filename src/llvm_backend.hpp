@@ -86,6 +86,13 @@ enum lbAddrKind {
 	lbAddr_BitField,
 };
 
+// NOTE: Column base pointers of a #soa slice or dynamic array being iterated, loaded on first use
+// in the block which enters the loop rather than once per access in the loop body
+struct lbSoaColumns {
+	LLVMValueRef   loop_entry; // the jump into the loop, before which the loads are inserted
+	Slice<lbValue> bases;
+};
+
 struct lbAddr {
 	lbAddrKind kind;
 	lbValue addr;
@@ -101,6 +108,7 @@ struct lbAddr {
 		struct {
 			lbValue index;
 			Ast *index_expr;
+			lbSoaColumns *columns;
 		} soa;
 		struct {
 			lbValue index;
@@ -130,6 +138,16 @@ struct lbIncompleteDebugType {
 
 typedef Slice<i32> lbStructFieldRemapping;
 
+// NOTE: Insert-only open-addressed cache from `Type *` to its LLVM type, in front of the
+// canonical hash map. Readers never lock; writers hold `types_mutex` and publish a slot's
+// value before its key, and a grown table replaces the old one which is never freed.
+struct lbTypeCache {
+	isize               capacity; // power of two
+	isize               count;
+	std::atomic<Type *> *keys;
+	LLVMTypeRef         *values;
+};
+
 enum lbFunctionPassManagerKind {
 	lbFunctionPassManager_default,
 	lbFunctionPassManager_default_without_memcpy,
@@ -161,6 +179,7 @@ struct lbModule {
 	RecursiveMutex types_mutex;
 	RecursiveMutex func_raw_types_mutex;
 	i32 internal_type_level;
+	std::atomic<lbTypeCache *> type_cache; // reads: lock-free, writes: types_mutex
 
 	RwMutex values_mutex;
 
@@ -327,6 +346,18 @@ struct lbVariadicReuseSlices {
 	lbAddr slice_addr;
 };
 
+struct lbBoundsCheckFailure {
+	LLVMBasicBlockRef block;
+	TokenPos          pos;
+	lbValue           args[5];
+};
+
+struct lbRangeIndexBound {
+	Entity *index;
+	Entity *array; // the index is known to be within `len(array)`
+	i64     count; // or within `count` if `array` is nullptr
+};
+
 struct lbProcedure {
 	u32 flags;
 	u16 state_flags;
@@ -389,6 +420,10 @@ struct lbProcedure {
 	PtrMap<LLVMValueRef, lbTupleFix> tuple_fix_map;
 
 	Array<lbValue> asan_stack_locals;
+
+	lbBlock *                   bounds_check_fail_block;
+	Array<lbBoundsCheckFailure> bounds_check_failures;
+	Array<lbRangeIndexBound>    range_index_bounds;
 };
 
 
@@ -479,6 +514,10 @@ gb_internal lbValue lb_emit_comp_against_nil(lbProcedure *p, TokenKind op_kind,
 
 gb_internal void lb_emit_jump(lbProcedure *p, lbBlock *target_block);
 gb_internal void lb_emit_if(lbProcedure *p, lbValue cond, lbBlock *true_block, lbBlock *false_block);
+gb_internal void lb_set_branch_weights(lbProcedure *p, LLVMValueRef branch, u32 true_weight, u32 false_weight);
+gb_internal void lb_emit_bounds_check_fail_block(lbProcedure *p);
+gb_internal bool lb_is_range_index_in_bounds(lbProcedure *p, Ast *index, Ast *array, i64 count);
+gb_internal void lb_set_debug_position_to_procedure_end(lbProcedure *p);
 gb_internal void lb_start_block(lbProcedure *p, lbBlock *b);
 
 gb_internal lbValue lb_build_call_expr(lbProcedure *p, Ast *expr);
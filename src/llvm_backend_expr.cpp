@@ -422,6 +422,100 @@ gb_internal bool lb_try_direct_vector_arith(lbProcedure *p, TokenKind op, lbValu
 }
 
 
+gb_internal bool lb_can_chunk_array_arith(TokenKind op, Type *array_type) {
+	Type *bt = base_type(array_type);
+	if (bt->kind != Type_Array) {
+		return false;
+	}
+	Type *elem = core_type(bt->Array.elem);
+	if (elem->kind != Type_Basic || !is_type_valid_vector_elem(elem) || is_type_boolean(elem) || elem->Basic.kind == Basic_rawptr) {
+		return false;
+	}
+	i64 elem_size = type_size_of(elem);
+	if (elem_size <= 0 || build_context.max_simd_align/elem_size < 2) {
+		return false;
+	}
+	switch (op) {
+	case Token_Add:
+	case Token_Sub:
+	case Token_Mul:
+		return true;
+	case Token_Quo:
+		return is_type_float(elem);
+	case Token_And:
+	case Token_Or:
+	case Token_Xor:
+	case Token_AndNot:
+		return is_type_integer(elem);
+	}
+	return false;
+}
+
+// NOTE: Lowers `dst^ = x^ op y^` on large fixed arrays into a loop over target-width vectors followed by the scalar
+// remainder. Each chunk is loaded before it is stored, so `dst` may be the same array as `x` or `y`.
+gb_internal void lb_emit_array_arith_chunked(lbProcedure *p, TokenKind op, lbValue dst, lbValue x, lbValue y, Type *array_type) {
+	lbModule *m = p->module;
+	GB_ASSERT(lb_can_chunk_array_arith(op, array_type));
+
+	Type *bt = base_type(array_type);
+	Type *elem_type = bt->Array.elem;
+	Type *elem = core_type(elem_type);
+	i64 count = bt->Array.count;
+	i64 width = build_context.max_simd_align / type_size_of(elem);
+	unsigned alignment = cast(unsigned)type_align_of(elem);
+
+	LLVMTypeRef vector_type = LLVMVectorType(lb_type(m, elem), cast(unsigned)width);
+	LLVMTypeRef vector_ptr_type = LLVMPointerType(vector_type, 0);
+
+	i64 chunks = count / width;
+	if (chunks > 0) {
+		auto loop_data = lb_loop_start(p, cast(isize)chunks, t_int);
+		lbValue offset = lb_emit_arith(p, Token_Mul, loop_data.idx, lb_const_int(m, t_int, width), t_int);
+
+		LLVMValueRef xp = LLVMBuildPointerCast(p->builder, lb_emit_array_ep(p, x, offset).value, vector_ptr_type, "");
+		LLVMValueRef yp = LLVMBuildPointerCast(p->builder, lb_emit_array_ep(p, y, offset).value, vector_ptr_type, "");
+		LLVMValueRef dp = LLVMBuildPointerCast(p->builder, lb_emit_array_ep(p, dst, offset).value, vector_ptr_type, "");
+
+		LLVMValueRef a = LLVMBuildLoad2(p->builder, vector_type, xp, "");
+		LLVMValueRef b = LLVMBuildLoad2(p->builder, vector_type, yp, "");
+		LLVMSetAlignment(a, alignment);
+		LLVMSetAlignment(b, alignment);
+
+		LLVMValueRef c = nullptr;
+		if (is_type_float(elem)) {
+			switch (op) {
+			case Token_Add: c = LLVMBuildFAdd(p->builder, a, b, ""); break;
+			case Token_Sub: c = LLVMBuildFSub(p->builder, a, b, ""); break;
+			case Token_Mul: c = LLVMBuildFMul(p->builder, a, b, ""); break;
+			case Token_Quo: c = LLVMBuildFDiv(p->builder, a, b, ""); break;
+			}
+		} else {
+			switch (op) {
+			case Token_Add:    c = LLVMBuildAdd(p->builder, a, b, ""); break;
+			case Token_Sub:    c = LLVMBuildSub(p->builder, a, b, ""); break;
+			case Token_Mul:    c = LLVMBuildMul(p->builder, a, b, ""); break;
+			case Token_And:    c = LLVMBuildAnd(p->builder, a, b, ""); break;
+			case Token_Or:     c = LLVMBuildOr(p->builder, a, b, "");  break;
+			case Token_Xor:    c = LLVMBuildXor(p->builder, a, b, ""); break;
+			case Token_AndNot: c = LLVMBuildAnd(p->builder, a, LLVMBuildNot(p->builder, b, ""), ""); break;
+			}
+		}
+		GB_ASSERT(c != nullptr);
+
+		LLVMValueRef store = LLVMBuildStore(p->builder, c, dp);
+		LLVMSetAlignment(store, alignment);
+
+		lb_loop_end(p, loop_data);
+	}
+
+	for (i64 i = chunks*width; i < count; i++) {
+		lbValue a = lb_emit_load(p, lb_emit_array_epi(p, x, cast(isize)i));
+		lbValue b = lb_emit_load(p, lb_emit_array_epi(p, y, cast(isize)i));
+		lbValue c = lb_emit_arith(p, op, a, b, elem_type);
+		lb_emit_store(p, lb_emit_array_epi(p, dst, cast(isize)i), c);
+	}
+}
+
 gb_internal lbValue lb_emit_arith_array(lbProcedure *p, TokenKind op, lbValue lhs, lbValue rhs, Type *type) {
 	GB_ASSERT(is_type_array_like(lhs.type) || is_type_array_like(rhs.type));
 
@@ -477,6 +571,11 @@ gb_internal lbValue lb_emit_arith_array(lbProcedure *p, TokenKind op, lbValue lh
 
 		lbAddr res = lb_add_local_generated(p, type, false);
 
+		if (lb_can_chunk_array_arith(op, type)) {
+			lb_emit_array_arith_chunked(p, op, res.addr, x, y, type);
+			return lb_addr_load(p, res);
+		}
+
 		auto loop_data = lb_loop_start(p, cast(isize)count, t_i32);
 
 		lbValue a_ptr = lb_emit_array_ep(p, x, loop_data.idx);
@@ -773,6 +872,69 @@ gb_internal lbValue lb_emit_outer_product(lbProcedure *p, lbValue a, lbValue b,
 
 }
 
+// NOTE: Products involving matrices with more internal elements than this are lowered to a loop
+// over the outer dimension rather than being fully unrolled, which keeps the IR linear in the size
+// of the operands
+gb_global i64 const LB_MATRIX_UNROLL_ELEMENT_MAX = 16;
+
+gb_internal bool lb_matrix_mul_is_blocked(Type *xt, Type *yt, Type *type) {
+	return matrix_type_total_internal_elems(xt)   > LB_MATRIX_UNROLL_ELEMENT_MAX ||
+	       matrix_type_total_internal_elems(yt)   > LB_MATRIX_UNROLL_ELEMENT_MAX ||
+	       matrix_type_total_internal_elems(type) > LB_MATRIX_UNROLL_ELEMENT_MAX;
+}
+
+gb_internal lbValue lb_emit_matrix_mul_blocked(lbProcedure *p, lbValue lhs, lbValue rhs, Type *type) {
+	Type *xt = base_type(lhs.type);
+	Type *yt = base_type(rhs.type);
+	Type *elem = xt->Matrix.elem;
+	bool is_row_major = xt->Matrix.is_row_major;
+
+	i64 outer_rows    = xt->Matrix.row_count;
+	i64 inner         = xt->Matrix.column_count;
+	i64 outer_columns = yt->Matrix.column_count;
+
+	lbValue x = lb_address_from_load_or_generate_local(p, lhs);
+	lbValue y = lb_address_from_load_or_generate_local(p, rhs);
+	lbAddr res = lb_add_local_generated(p, type, true);
+
+	// NOTE: Each iteration produces one contiguous column (or row for #row_major) of the result,
+	// keeping its partial sums in registers. The summation order per element matches the unrolled form.
+	i64 block_count = is_row_major ? outer_rows    : outer_columns;
+	i64 block_width = is_row_major ? outer_columns : outer_rows;
+
+	auto sums = slice_make<lbValue>(temporary_allocator(), block_width);
+
+	lbLoopData loop = lb_loop_start(p, block_count, t_int);
+	for (i64 w = 0; w < block_width; w++) {
+		sums[w] = lb_const_nil(p->module, elem);
+	}
+	for (i64 k = 0; k < inner; k++) {
+		lbValue k_index = lb_const_int(p->module, t_int, k);
+		if (is_row_major) {
+			lbValue a = lb_emit_load(p, lb_emit_matrix_ep(p, x, loop.idx, k_index));
+			for (i64 j = 0; j < block_width; j++) {
+				lbValue b = lb_emit_load(p, lb_emit_matrix_epi(p, y, k, j));
+				sums[j] = lb_emit_mul_add(p, a, b, sums[j], elem);
+			}
+		} else {
+			lbValue b = lb_emit_load(p, lb_emit_matrix_ep(p, y, k_index, loop.idx));
+			for (i64 i = 0; i < block_width; i++) {
+				lbValue a = lb_emit_load(p, lb_emit_matrix_epi(p, x, i, k));
+				sums[i] = lb_emit_mul_add(p, a, b, sums[i], elem);
+			}
+		}
+	}
+	for (i64 w = 0; w < block_width; w++) {
+		lbValue w_index = lb_const_int(p->module, t_int, w);
+		lbValue dst = is_row_major ? lb_emit_matrix_ep(p, res.addr, loop.idx, w_index)
+		                           : lb_emit_matrix_ep(p, res.addr, w_index, loop.idx);
+		lb_emit_store(p, dst, sums[w]);
+	}
+	lb_loop_end(p, loop);
+
+	return lb_addr_load(p, res);
+}
+
 gb_internal lbValue lb_emit_matrix_mul(lbProcedure *p, lbValue lhs, lbValue rhs, Type *type) {
 	// TODO(bill): Handle edge case for f16 types on x86(-64) platforms
 
@@ -792,6 +954,10 @@ gb_internal lbValue lb_emit_matrix_mul(lbProcedure *p, lbValue lhs, lbValue rhs,
 	unsigned inner         = cast(unsigned)xt->Matrix.column_count;
 	unsigned outer_columns = cast(unsigned)yt->Matrix.column_count;
 
+	if (lb_matrix_mul_is_blocked(xt, yt, type)) {
+		return lb_emit_matrix_mul_blocked(p, lhs, rhs, type);
+	}
+
 	if (!xt->Matrix.is_row_major && lb_is_matrix_simdable(xt)) {
 		unsigned x_stride = cast(unsigned)matrix_type_stride_in_elems(xt);
 		unsigned y_stride = cast(unsigned)matrix_type_stride_in_elems(yt);
@@ -937,19 +1103,25 @@ gb_internal lbValue lb_emit_matrix_mul_vector(lbProcedure *p, lbValue lhs, lbVal
 		return lb_matrix_cast_vector_to_type(p, vector, type);
 	}
 
+	// NOTE: The matrix is addressed once and every partial sum stays in a register, so the IR is
+	// linear in the number of elements rather than reloading the result per product
+	lbValue m = lb_address_from_load_or_generate_local(p, lhs);
 	lbAddr res = lb_add_local_generated(p, type, true);
 
+	auto sums = slice_make<lbValue>(temporary_allocator(), mt->Matrix.row_count);
 	for (i64 i = 0; i < mt->Matrix.row_count; i++) {
-		for (i64 j = 0; j < mt->Matrix.column_count; j++) {
-			lbValue dst = lb_emit_matrix_epi(p, res.addr, i, 0);
-			lbValue d0 = lb_emit_load(p, dst);
-
-			lbValue a = lb_emit_matrix_ev(p, lhs, i, j);
-			lbValue b = lb_emit_struct_ev(p, rhs, cast(i32)j);
-			lbValue c = lb_emit_mul_add(p, a, b, d0, elem);
-			lb_emit_store(p, dst, c);
+		sums[i] = lb_const_nil(p->module, elem);
+	}
+	for (i64 j = 0; j < mt->Matrix.column_count; j++) {
+		lbValue b = lb_emit_struct_ev(p, rhs, cast(i32)j);
+		for (i64 i = 0; i < mt->Matrix.row_count; i++) {
+			lbValue a = lb_emit_load(p, lb_emit_matrix_epi(p, m, i, j));
+			sums[i] = lb_emit_mul_add(p, a, b, sums[i], elem);
 		}
 	}
+	for (i64 i = 0; i < mt->Matrix.row_count; i++) {
+		lb_emit_store(p, lb_emit_matrix_epi(p, res.addr, i, 0), sums[i]);
+	}
 
 	return lb_addr_load(p, res);
 }
@@ -1021,19 +1193,23 @@ gb_internal lbValue lb_emit_vector_mul_matrix(lbProcedure *p, lbValue lhs, lbVal
 		return lb_addr_load(p, res);
 	}
 
+	lbValue m = lb_address_from_load_or_generate_local(p, rhs);
 	lbAddr res = lb_add_local_generated(p, type, true);
 
+	auto sums = slice_make<lbValue>(temporary_allocator(), mt->Matrix.column_count);
 	for (i64 j = 0; j < mt->Matrix.column_count; j++) {
-		for (i64 k = 0; k < mt->Matrix.row_count; k++) {
-			lbValue dst = lb_emit_matrix_epi(p, res.addr, 0, j);
-			lbValue d0 = lb_emit_load(p, dst);
-
-			lbValue a = lb_emit_struct_ev(p, lhs, cast(i32)k);
-			lbValue b = lb_emit_matrix_ev(p, rhs, k, j);
-			lbValue c = lb_emit_mul_add(p, a, b, d0, elem);
-			lb_emit_store(p, dst, c);
+		sums[j] = lb_const_nil(p->module, elem);
+	}
+	for (i64 k = 0; k < mt->Matrix.row_count; k++) {
+		lbValue a = lb_emit_struct_ev(p, lhs, cast(i32)k);
+		for (i64 j = 0; j < mt->Matrix.column_count; j++) {
+			lbValue b = lb_emit_load(p, lb_emit_matrix_epi(p, m, k, j));
+			sums[j] = lb_emit_mul_add(p, a, b, sums[j], elem);
 		}
 	}
+	for (i64 j = 0; j < mt->Matrix.column_count; j++) {
+		lb_emit_store(p, lb_emit_matrix_epi(p, res.addr, 0, j), sums[j]);
+	}
 
 	return lb_addr_load(p, res);
 }
@@ -2516,6 +2692,52 @@ gb_internal lbValue lb_emit_c_vararg(lbProcedure *p, lbValue arg, Type *type) {
 	return lb_emit_conv(p, arg, promoted);
 }
 
+enum {LB_INLINE_MEMORY_EQUAL_MAX_BYTES = 64};
+
+// NOTE: Compares `size` bytes with wide loads, XORing each pair of words and ORing the differences together, which
+// LLVM can turn into vector compares where the target supports them
+gb_internal lbValue lb_emit_inline_memory_equal(lbProcedure *p, TokenKind op_kind, lbValue left_ptr, lbValue right_ptr, i64 size) {
+	lbModule *m = p->module;
+	GB_ASSERT(op_kind == Token_CmpEq || op_kind == Token_NotEq);
+	GB_ASSERT(0 < size && size <= LB_INLINE_MEMORY_EQUAL_MAX_BYTES);
+
+	left_ptr  = lb_emit_conv(p, left_ptr,  t_u8_ptr);
+	right_ptr = lb_emit_conv(p, right_ptr, t_u8_ptr);
+
+	i64 max_word = 16;
+	while (max_word > size) {
+		max_word >>= 1;
+	}
+	LLVMTypeRef acc_type = LLVMIntTypeInContext(m->ctx, cast(unsigned)(8*max_word));
+	LLVMValueRef acc = nullptr;
+
+	for (i64 offset = 0; offset < size; /**/) {
+		i64 n = max_word;
+		while (n > size-offset) {
+			n >>= 1;
+		}
+		LLVMTypeRef word_type = LLVMIntTypeInContext(m->ctx, cast(unsigned)(8*n));
+		LLVMTypeRef word_ptr_type = LLVMPointerType(word_type, 0);
+		lbValue offset_value = lb_const_int(m, t_int, offset);
+
+		LLVMValueRef a_ptr = LLVMBuildPointerCast(p->builder, lb_emit_ptr_offset(p, left_ptr,  offset_value).value, word_ptr_type, "");
+		LLVMValueRef b_ptr = LLVMBuildPointerCast(p->builder, lb_emit_ptr_offset(p, right_ptr, offset_value).value, word_ptr_type, "");
+		LLVMValueRef a = LLVMBuildLoad2(p->builder, word_type, a_ptr, "");
+		LLVMValueRef b = LLVMBuildLoad2(p->builder, word_type, b_ptr, "");
+		LLVMSetAlignment(a, 1);
+		LLVMSetAlignment(b, 1);
+
+		LLVMValueRef diff = LLVMBuildXor(p->builder, a, b, "");
+		diff = LLVMBuildZExtOrBitCast(p->builder, diff, acc_type, "");
+		acc = acc ? LLVMBuildOr(p->builder, acc, diff, "") : diff;
+		offset += n;
+	}
+
+	LLVMIntPredicate pred = op_kind == Token_CmpEq ? LLVMIntEQ : LLVMIntNE;
+	LLVMValueRef res = LLVMBuildICmp(p->builder, pred, acc, LLVMConstNull(acc_type), "");
+	return {res, t_llvm_bool};
+}
+
 gb_internal lbValue lb_compare_records(lbProcedure *p, TokenKind op_kind, lbValue left, lbValue right, Type *type) {
 	GB_ASSERT((is_type_struct(type) || is_type_soa_pointer(type) || is_type_union(type)) && is_type_comparable(type));
 	lbValue left_ptr  = lb_address_from_load_or_generate_local(p, left);
@@ -2531,8 +2753,10 @@ gb_internal lbValue lb_compare_records(lbProcedure *p, TokenKind op_kind, lbValu
 		GB_PANIC("invalid operator");
 	}
 	TEMPORARY_ALLOCATOR_GUARD();
-	if (is_type_simple_compare(type)) {
-		// TODO(bill): Test to see if this is actually faster!!!!
+	if (is_type_simple_compare(type) && type_size_of(type) <= LB_INLINE_MEMORY_EQUAL_MAX_BYTES) {
+		res = lb_emit_inline_memory_equal(p, op_kind, left_ptr, right_ptr, type_size_of(type));
+		return lb_emit_conv(p, res, t_bool);
+	} else if (is_type_simple_compare(type)) {
 		auto args = array_make<lbValue>(temporary_allocator(), 3);
 		args[0] = lb_emit_conv(p, left_ptr, t_rawptr);
 		args[1] = lb_emit_conv(p, right_ptr, t_rawptr);
@@ -3852,8 +4076,8 @@ gb_internal lbValue lb_get_using_variable(lbProcedure *p, Entity *e) {
 	} else if (pv != nullptr) {
 		v = *pv;
 	} else {
-		GB_ASSERT_MSG(e->using_expr != nullptr, "%.*s", LIT(name));
-		v = lb_build_addr_ptr(p, e->using_expr);
+		GB_ASSERT_MSG(entity_cold(e)->using_expr != nullptr, "%.*s", LIT(name));
+		v = lb_build_addr_ptr(p, entity_cold(e)->using_expr);
 	}
 	GB_ASSERT(v.value != nullptr);
 	GB_ASSERT_MSG(is_soa || parent->type == type_deref(v.type), "%s %s", type_to_string(parent->type), type_to_string(v.type));
@@ -4182,7 +4406,7 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		lbValue elem = lb_emit_array_ep(p, array, index);
 
 		auto index_tv = type_and_value_of_expr(ie->index);
-		if (index_tv.mode != Addressing_Constant) {
+		if (index_tv.mode != Addressing_Constant && !lb_is_range_index_in_bounds(p, ie->index, nullptr, t->Array.count)) {
 			lbValue len = lb_const_int(p->module, t_int, t->Array.count);
 			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
 		}
@@ -4233,8 +4457,10 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		}
 		lbValue elem = lb_slice_elem(p, slice);
 		lbValue index = lb_emit_conv(p, lb_build_expr(p, ie->index), t_int);
-		lbValue len = lb_slice_len(p, slice);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		if (deref || !lb_is_range_index_in_bounds(p, ie->index, ie->expr, 0)) {
+			lbValue len = lb_slice_len(p, slice);
+			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		}
 		lbValue v = lb_emit_ptr_offset(p, elem, index);
 		return lb_addr(v);
 	}
@@ -4312,7 +4538,9 @@ gb_internal lbAddr lb_build_addr_index_expr(lbProcedure *p, Ast *expr) {
 		len = lb_string_len(p, str);
 
 		index = lb_emit_conv(p, lb_build_expr(p, ie->index), t_int);
-		lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		if (deref || !lb_is_range_index_in_bounds(p, ie->index, ie->expr, 0)) {
+			lb_emit_bounds_check(p, ast_token(ie->index), index, len);
+		}
 
 		return lb_addr(lb_emit_ptr_offset(p, elem, index));
 	}
@@ -5256,8 +5484,6 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 					sub_sel.index.data += 1;
 					sub_sel.index.count -= 1;
 
-					lbValue arr = lb_emit_struct_ep(p, addr.addr, first_index);
-
 					Type *t = base_type(type_deref(addr.addr.type));
 					GB_ASSERT(is_type_soa_struct(t));
 
@@ -5269,9 +5495,11 @@ gb_internal lbAddr lb_build_addr_internal(lbProcedure *p, Ast *expr) {
 					lbValue item = {};
 
 					if (t->Struct.soa_kind == StructSoa_Fixed) {
-						item = lb_emit_array_ep(p, arr, index);
+						item = lb_emit_array_ep(p, lb_emit_struct_ep(p, addr.addr, first_index), index);
+					} else if (addr.soa.columns != nullptr) {
+						item = lb_emit_ptr_offset(p, lb_soa_column_base(p, addr, first_index), index);
 					} else {
-						item = lb_emit_ptr_offset(p, lb_emit_load(p, arr), index);
+						item = lb_emit_ptr_offset(p, lb_emit_load(p, lb_emit_struct_ep(p, addr.addr, first_index)), index);
 					}
 					if (sub_sel.index.count > 0) {
 						item = lb_emit_deep_field_gep(p, item, sub_sel);
@@ -453,6 +453,18 @@ gb_internal lbAddr lb_addr_soa_variable(lbValue addr, lbValue index, Ast *index_
 	return v;
 }
 
+gb_internal lbValue lb_soa_column_base(lbProcedure *p, lbAddr const &addr, i32 field_index) {
+	GB_ASSERT(addr.kind == lbAddr_SoaVariable && addr.soa.columns != nullptr);
+	lbSoaColumns *columns = addr.soa.columns;
+	if (columns->bases[field_index].value == nullptr) {
+		LLVMBasicBlockRef insert_block = LLVMGetInsertBlock(p->builder);
+		LLVMPositionBuilderBefore(p->builder, columns->loop_entry);
+		columns->bases[field_index] = lb_emit_load(p, lb_emit_struct_ep(p, addr.addr, field_index));
+		LLVMPositionBuilderAtEnd(p->builder, insert_block);
+	}
+	return columns->bases[field_index];
+}
+
 gb_internal lbAddr lb_addr_swizzle(lbValue addr, Type *array_type, u8 swizzle_count, u8 swizzle_indices[4]) {
 	GB_ASSERT(is_type_array(array_type) || is_type_simd_vector(array_type));
 	GB_ASSERT(1 < swizzle_count && swizzle_count <= 4);
@@ -591,6 +603,21 @@ gb_internal void lb_set_file_line_col(lbProcedure *p, Array<lbValue> arr, TokenP
 	arr[2] = lb_const_int(p->module, t_i32, col);
 }
 
+gb_internal void lb_set_branch_weights(lbProcedure *p, LLVMValueRef branch, u32 true_weight, u32 false_weight) {
+	if (branch == nullptr || !LLVMIsABranchInst(branch) || !LLVMIsConditional(branch)) {
+		return;
+	}
+	LLVMContextRef ctx = p->module->ctx;
+	char const *name = "branch_weights";
+	LLVMMetadataRef ops[3] = {
+		LLVMMDStringInContext2(ctx, name, gb_strlen(name)),
+		LLVMValueAsMetadata(LLVMConstInt(LLVMInt32TypeInContext(ctx), true_weight,  false)),
+		LLVMValueAsMetadata(LLVMConstInt(LLVMInt32TypeInContext(ctx), false_weight, false)),
+	};
+	unsigned kind = LLVMGetMDKindIDInContext(ctx, "prof", 4);
+	LLVMSetMetadata(branch, kind, LLVMMetadataAsValue(ctx, LLVMMDNodeInContext2(ctx, ops, gb_count_of(ops))));
+}
+
 gb_internal void lb_emit_bounds_check(lbProcedure *p, Token token, lbValue index, lbValue len) {
 	if (build_context.no_bounds_check) {
 		return;
@@ -599,17 +626,88 @@ gb_internal void lb_emit_bounds_check(lbProcedure *p, Token token, lbValue index
 		return;
 	}
 
-	TEMPORARY_ALLOCATOR_GUARD();
+	if (p->curr_block == nullptr) {
+		return;
+	}
+	LLVMValueRef last_instr = LLVMGetLastInstruction(p->curr_block->block);
+	if (last_instr != nullptr && LLVMIsATerminatorInst(last_instr)) {
+		return;
+	}
 
 	index = lb_emit_conv(p, index, t_int);
 	len = lb_emit_conv(p, len, t_int);
 
+	// NOTE: The comparison is done inline and every failing check in the procedure branches to a single
+	// cold block which calls the runtime, see `lb_emit_bounds_check_fail_block`
+	if (p->bounds_check_fail_block == nullptr) {
+		p->bounds_check_fail_block = lb_create_block(p, "bounds_check.fail");
+	}
+
+	lbBoundsCheckFailure failure = {};
+	failure.block = p->curr_block->block;
+	failure.pos   = token.pos;
+	Array<lbValue> file_line_col = {};
+	file_line_col.data  = failure.args;
+	file_line_col.count = 3;
+	lb_set_file_line_col(p, file_line_col, token.pos);
+	failure.args[3] = index;
+	failure.args[4] = len;
+	array_add(&p->bounds_check_failures, failure);
+
+	lbBlock *ok = lb_create_block(p, "bounds_check.ok");
+	lbValue in_bounds = lb_emit_comp(p, Token_Lt, lb_emit_conv(p, index, t_uint), lb_emit_conv(p, len, t_uint));
+	lb_emit_if(p, in_bounds, ok, p->bounds_check_fail_block);
+	lb_set_branch_weights(p, LLVMGetLastInstruction(p->curr_block->block), 1<<20, 1);
+	lb_start_block(p, ok);
+}
+
+gb_internal void lb_emit_bounds_check_fail_block(lbProcedure *p) {
+	lbBlock *block = p->bounds_check_fail_block;
+	if (block == nullptr) {
+		return;
+	}
+	p->bounds_check_fail_block = nullptr;
+
+	auto const &failures = p->bounds_check_failures;
+	GB_ASSERT(failures.count > 0);
+
+	lb_start_block(p, block);
+	if (failures.count == 1) {
+		if (p->debug_info != nullptr && failures[0].pos.file_id != 0) {
+			LLVMSetCurrentDebugLocation2(p->builder, lb_debug_location_from_token_pos(p, failures[0].pos));
+		}
+	} else {
+		lb_set_debug_position_to_procedure_end(p);
+	}
+
+	TEMPORARY_ALLOCATOR_GUARD();
+
 	auto args = array_make<lbValue>(temporary_allocator(), 5);
-	lb_set_file_line_col(p, args, token.pos);
-	args[3] = index;
-	args[4] = len;
+	auto values = array_make<LLVMValueRef>(temporary_allocator(), failures.count);
+	auto blocks = array_make<LLVMBasicBlockRef>(temporary_allocator(), failures.count);
+	for (isize i = 0; i < args.count; i++) {
+		args[i] = failures[0].args[i];
+
+		bool same = true;
+		for_array(j, failures) {
+			values[j] = failures[j].args[i].value;
+			blocks[j] = failures[j].block;
+			same = same && values[j] == values[0];
+		}
+		if (!same) {
+			args[i].value = LLVMBuildPhi(p->builder, lb_type(p->module, args[i].type), "");
+			LLVMAddIncoming(args[i].value, values.data, blocks.data, cast(unsigned)failures.count);
+		}
+	}
 
 	lb_emit_runtime_call(p, "bounds_check_error", args);
+	LLVMValueRef call = LLVMGetLastInstruction(p->curr_block->block);
+	if (call != nullptr && LLVMIsACallInst(call)) {
+		LLVMAddCallSiteAttribute(call, LLVMAttributeFunctionIndex, lb_create_enum_attribute(p->module->ctx, "cold"));
+	}
+	LLVMBuildUnreachable(p->builder);
+
+	array_clear(&p->bounds_check_failures);
 }
 
 gb_internal void lb_emit_matrix_bounds_check(lbProcedure *p, Token token, lbValue row_index, lbValue column_index, lbValue row_count, lbValue column_count) {
@@ -1502,7 +1600,7 @@ gb_internal String lb_get_entity_name(lbModule *m, Entity *e) {
 	} else if (e->kind == Entity_Procedure) {
 		e->Procedure.link_name = name;
 	} else if (e->kind == Entity_Variable) {
-		e->Variable.link_name = name;
+		entity_make_cold(e)->link_name = name;
 	}
 
 	return name;
@@ -2244,14 +2342,92 @@ gb_internal LLVMTypeRef lb_type_internal(lbModule *m, Type *type) {
 	return LLVMInt32TypeInContext(ctx);
 }
 
+enum {LB_TYPE_CACHE_INITIAL_CAPACITY = 256};
+
+gb_internal LLVMTypeRef lb_type_cache_get(lbModule *m, Type *type) {
+	lbTypeCache *cache = m->type_cache.load(std::memory_order_acquire);
+	if (cache == nullptr) {
+		return nullptr;
+	}
+	usize mask = cast(usize)cache->capacity-1;
+	usize index = ptr_map_hash_key(type) & mask;
+	for (;;) {
+		Type *key = cache->keys[index].load(std::memory_order_acquire);
+		if (key == type) {
+			return cache->values[index];
+		} else if (key == nullptr) {
+			return nullptr;
+		}
+		index = (index+1) & mask;
+	}
+}
+
+gb_internal void lb_type_cache_insert(lbTypeCache *cache, Type *type, LLVMTypeRef llvm_type) {
+	usize mask = cast(usize)cache->capacity-1;
+	usize index = ptr_map_hash_key(type) & mask;
+	for (;;) {
+		Type *key = cache->keys[index].load(std::memory_order_relaxed);
+		if (key == type) {
+			return;
+		} else if (key == nullptr) {
+			cache->values[index] = llvm_type;
+			cache->keys[index].store(type, std::memory_order_release);
+			cache->count += 1;
+			return;
+		}
+		index = (index+1) & mask;
+	}
+}
+
+gb_internal lbTypeCache *lb_type_cache_alloc(isize capacity) {
+	gbAllocator a = permanent_allocator();
+	lbTypeCache *cache = gb_alloc_item(a, lbTypeCache);
+	cache->capacity = capacity;
+	cache->count    = 0;
+	cache->keys     = gb_alloc_array(a, std::atomic<Type *>, capacity);
+	cache->values   = gb_alloc_array(a, LLVMTypeRef, capacity);
+	for (isize i = 0; i < capacity; i++) {
+		cache->keys[i].store(nullptr, std::memory_order_relaxed);
+	}
+	return cache;
+}
+
+// NOTE: must be called with `m->types_mutex` held
+gb_internal void lb_type_cache_set(lbModule *m, Type *type, LLVMTypeRef llvm_type) {
+	lbTypeCache *cache = m->type_cache.load(std::memory_order_relaxed);
+	if (cache == nullptr) {
+		cache = lb_type_cache_alloc(LB_TYPE_CACHE_INITIAL_CAPACITY);
+		m->type_cache.store(cache, std::memory_order_release);
+	} else if (2*(cache->count+1) > cache->capacity) {
+		lbTypeCache *grown = lb_type_cache_alloc(2*cache->capacity);
+		for (isize i = 0; i < cache->capacity; i++) {
+			Type *key = cache->keys[i].load(std::memory_order_relaxed);
+			if (key != nullptr) {
+				lb_type_cache_insert(grown, key, cache->values[i]);
+			}
+		}
+		cache = grown;
+		m->type_cache.store(cache, std::memory_order_release);
+	}
+	lb_type_cache_insert(cache, type, llvm_type);
+}
+
 gb_internal LLVMTypeRef lb_type(lbModule *m, Type *type) {
 	type = default_type(type);
 
+	if (LLVMTypeRef cached = lb_type_cache_get(m, type)) {
+		return cached;
+	}
+
 	mutex_lock(&m->types_mutex);
 	defer (mutex_unlock(&m->types_mutex));
 
 	LLVMTypeRef *found = map_get(&m->types, type);
 	if (found) {
+		if (m->internal_type_level == 0) {
+			// NOTE: nested lookups may see a named struct whose body is still being built
+			lb_type_cache_set(m, type, *found);
+		}
 		return *found;
 	}
 
@@ -2262,6 +2438,7 @@ gb_internal LLVMTypeRef lb_type(lbModule *m, Type *type) {
 	m->internal_type_level -= 1;
 	if (m->internal_type_level == 0) {
 		map_set(&m->types, type, llvm_type);
+		lb_type_cache_set(m, type, llvm_type);
 	}
 	return llvm_type;
 }
@@ -3029,7 +3206,7 @@ gb_internal lbValue lb_find_value_from_entity(lbModule *m, Entity *e) {
 
 			lb_set_entity_from_other_modules_linkage_correctly(other_module, e, name);
 
-			lb_apply_thread_local_model(g.value, e->Variable.thread_local_model);
+			lb_apply_thread_local_model(g.value, entity_cold(e)->thread_local_model);
 
 			return g;
 		}
@@ -130,6 +130,8 @@ gb_internal lbProcedure *lb_create_procedure(lbModule *m, Entity *entity, bool i
 	p->context_stack.allocator     = a;
 	p->scope_stack.allocator       = a;
 	p->asan_stack_locals.allocator = a;
+	p->bounds_check_failures.allocator = a;
+	p->range_index_bounds.allocator    = a;
 	// map_init(&p->selector_values,  0);
 	// map_init(&p->selector_addr,    0);
 	// map_init(&p->tuple_fix_map,    0);
@@ -400,6 +402,8 @@ gb_internal lbProcedure *lb_create_dummy_procedure(lbModule *m, String link_name
 	p->branch_blocks.allocator     = a;
 	p->context_stack.allocator     = a;
 	p->asan_stack_locals.allocator = a;
+	p->bounds_check_failures.allocator = a;
+	p->range_index_bounds.allocator    = a;
 	map_init(&p->tuple_fix_map, 0);
 
 
@@ -777,6 +781,8 @@ gb_internal void lb_end_procedure_body(lbProcedure *p) {
 		}
 	}
 
+	lb_emit_bounds_check_fail_block(p);
+
 	LLVMBasicBlockRef first_block = LLVMGetFirstBasicBlock(p->value);
 	LLVMBasicBlockRef block = nullptr;
 
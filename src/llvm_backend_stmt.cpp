@@ -447,62 +447,382 @@ gb_internal lbValue lb_map_hash_is_valid(lbProcedure *p, lbValue hash) {
 	return lb_emit_arith(p, Token_And, not_deleted, not_empty, t_uintptr);
 }
 
-gb_internal void lb_build_range_map(lbProcedure *p, lbValue expr, Type *val_type,
-                                    lbValue *val_, lbValue *key_, lbBlock **loop_, lbBlock **done_) {
+gb_internal bool lb_range_expr_may_move_data(Ast *expr, Entity *ranged);
+
+gb_internal bool lb_range_expr_list_may_move_data(Slice<Ast *> const &exprs, Entity *ranged) {
+	for (Ast *expr : exprs) {
+		if (lb_range_expr_may_move_data(expr, ranged)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+gb_internal bool lb_range_expr_may_move_data(Ast *expr, Entity *ranged) {
+	expr = unparen_expr(expr);
+	if (expr == nullptr) {
+		return false;
+	}
+	switch (expr->kind) {
+	case Ast_Ident:
+	case Ast_Implicit:
+	case Ast_BasicLit:
+	case Ast_BasicDirective:
+	case Ast_ImplicitSelectorExpr:
+	case Ast_ProcLit:
+		return false;
+
+	case Ast_UnaryExpr:
+		if (expr->UnaryExpr.op.kind == Token_And) {
+			Ast *x = unparen_expr(expr->UnaryExpr.expr);
+			if (x->kind == Ast_Ident && entity_of_node(x) == ranged) {
+				return true;
+			}
+		}
+		return lb_range_expr_may_move_data(expr->UnaryExpr.expr, ranged);
+	case Ast_BinaryExpr:
+		return lb_range_expr_may_move_data(expr->BinaryExpr.left, ranged) ||
+		       lb_range_expr_may_move_data(expr->BinaryExpr.right, ranged);
+	case Ast_SelectorExpr:
+		return lb_range_expr_may_move_data(expr->SelectorExpr.expr, ranged);
+	case Ast_IndexExpr:
+		return lb_range_expr_may_move_data(expr->IndexExpr.expr, ranged) ||
+		       lb_range_expr_may_move_data(expr->IndexExpr.index, ranged);
+	case Ast_MatrixIndexExpr:
+		return lb_range_expr_may_move_data(expr->MatrixIndexExpr.expr, ranged) ||
+		       lb_range_expr_may_move_data(expr->MatrixIndexExpr.row_index, ranged) ||
+		       lb_range_expr_may_move_data(expr->MatrixIndexExpr.column_index, ranged);
+	case Ast_SliceExpr:
+		return lb_range_expr_may_move_data(expr->SliceExpr.expr, ranged) ||
+		       lb_range_expr_may_move_data(expr->SliceExpr.low, ranged) ||
+		       lb_range_expr_may_move_data(expr->SliceExpr.high, ranged);
+	case Ast_DerefExpr:
+		return lb_range_expr_may_move_data(expr->DerefExpr.expr, ranged);
+	case Ast_TernaryIfExpr:
+		return lb_range_expr_may_move_data(expr->TernaryIfExpr.x, ranged) ||
+		       lb_range_expr_may_move_data(expr->TernaryIfExpr.cond, ranged) ||
+		       lb_range_expr_may_move_data(expr->TernaryIfExpr.y, ranged);
+	case Ast_TernaryWhenExpr:
+		return lb_range_expr_may_move_data(expr->TernaryWhenExpr.x, ranged) ||
+		       lb_range_expr_may_move_data(expr->TernaryWhenExpr.y, ranged);
+	case Ast_TypeCast:
+		return lb_range_expr_may_move_data(expr->TypeCast.expr, ranged);
+	case Ast_AutoCast:
+		return lb_range_expr_may_move_data(expr->AutoCast.expr, ranged);
+	case Ast_TypeAssertion:
+		return lb_range_expr_may_move_data(expr->TypeAssertion.expr, ranged);
+	case Ast_FieldValue:
+		return lb_range_expr_may_move_data(expr->FieldValue.value, ranged);
+	case Ast_CompoundLit:
+		return lb_range_expr_list_may_move_data(expr->CompoundLit.elems, ranged);
+
+	case Ast_CallExpr: {
+		// NOTE: Only conversions and the builtins which never write to memory are known not to move the data
+		TypeAndValue tav = type_and_value_of_expr(expr->CallExpr.proc);
+		if (tav.mode == Addressing_Type) {
+			return lb_range_expr_list_may_move_data(expr->CallExpr.args, ranged);
+		}
+		if (tav.mode == Addressing_Builtin) {
+			Entity *e = entity_of_node(expr->CallExpr.proc);
+			if (e != nullptr && e->kind == Entity_Builtin && cast(BuiltinProcId)e->Builtin.id < BuiltinProc_DIRECTIVE) {
+				return lb_range_expr_list_may_move_data(expr->CallExpr.args, ranged);
+			}
+		}
+		return true;
+	}
+	}
+	return true;
+}
+
+// NOTE: Whether an assignment to `lhs` may write through to the header of `ranged`.
+// Only locals (including the loop value itself) and their fields or fixed ranged elements are known to be safe.
+gb_internal bool lb_range_lhs_may_move_data(Ast *lhs, Entity *ranged) {
+	lhs = unparen_expr(lhs);
+	for (;;) {
+		if (lhs->kind == Ast_SelectorExpr) {
+			if (is_type_pointer(type_of_expr(lhs->SelectorExpr.expr))) {
+				return true;
+			}
+			lhs = unparen_expr(lhs->SelectorExpr.expr);
+		} else if (lhs->kind == Ast_IndexExpr) {
+			Type *t = type_of_expr(lhs->IndexExpr.expr);
+			if (t == nullptr || (!is_type_array(t) && !is_type_enumerated_array(t))) {
+				return true;
+			}
+			lhs = unparen_expr(lhs->IndexExpr.expr);
+		} else {
+			break;
+		}
+	}
+	if (lhs->kind != Ast_Ident) {
+		return true;
+	}
+	if (is_blank_ident(lhs)) {
+		return false;
+	}
+	Entity *e = entity_of_node(lhs);
+	if (e == nullptr || e == ranged || e->kind != Entity_Variable) {
+		return true;
+	}
+	if (e->flags & (EntityFlag_Static|EntityFlag_Field|EntityFlag_Using)) {
+		return true;
+	}
+	if (e->scope == nullptr || (e->scope->flags & (ScopeFlag_Pkg|ScopeFlag_File|ScopeFlag_Global))) {
+		return true;
+	}
+	return false;
+}
+
+gb_internal bool lb_range_body_may_move_data(Ast *stmt, Entity *ranged);
+
+gb_internal bool lb_range_body_list_may_move_data(Slice<Ast *> const &stmts, Entity *ranged) {
+	for (Ast *stmt : stmts) {
+		if (lb_range_body_may_move_data(stmt, ranged)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// NOTE: Conservatively, whether the body of a range over the variable `ranged` may change its header, e.g. by
+// appending to or inserting into it, in which case pointers to its data must not be hoisted out of the loop.
+gb_internal bool lb_range_body_may_move_data(Ast *stmt, Entity *ranged) {
+	if (stmt == nullptr) {
+		return false;
+	}
+	switch (stmt->kind) {
+	case Ast_EmptyStmt:
+	case Ast_BranchStmt:
+		return false;
+
+	case Ast_ExprStmt:
+		return lb_range_expr_may_move_data(stmt->ExprStmt.expr, ranged);
+
+	case Ast_AssignStmt:
+		for (Ast *lhs : stmt->AssignStmt.lhs) {
+			if (lb_range_lhs_may_move_data(lhs, ranged)) {
+				return true;
+			}
+		}
+		return lb_range_expr_list_may_move_data(stmt->AssignStmt.lhs, ranged) ||
+		       lb_range_expr_list_may_move_data(stmt->AssignStmt.rhs, ranged);
+
+	case Ast_ValueDecl:
+		if (!stmt->ValueDecl.is_mutable) {
+			return false;
+		}
+		return lb_range_expr_list_may_move_data(stmt->ValueDecl.values, ranged);
+
+	case Ast_DeferStmt:
+		return lb_range_body_may_move_data(stmt->DeferStmt.stmt, ranged);
+
+	case Ast_ReturnStmt:
+		return lb_range_expr_list_may_move_data(stmt->ReturnStmt.results, ranged);
+
+	case Ast_BlockStmt:
+		return lb_range_body_list_may_move_data(stmt->BlockStmt.stmts, ranged);
+
+	case Ast_IfStmt:
+		return lb_range_body_may_move_data(stmt->IfStmt.init, ranged) ||
+		       lb_range_expr_may_move_data(stmt->IfStmt.cond, ranged) ||
+		       lb_range_body_may_move_data(stmt->IfStmt.body, ranged) ||
+		       lb_range_body_may_move_data(stmt->IfStmt.else_stmt, ranged);
+
+	case Ast_WhenStmt:
+		return lb_range_body_may_move_data(stmt->WhenStmt.body, ranged) ||
+		       lb_range_body_may_move_data(stmt->WhenStmt.else_stmt, ranged);
+
+	case Ast_ForStmt:
+		return lb_range_body_may_move_data(stmt->ForStmt.init, ranged) ||
+		       lb_range_expr_may_move_data(stmt->ForStmt.cond, ranged) ||
+		       lb_range_body_may_move_data(stmt->ForStmt.post, ranged) ||
+		       lb_range_body_may_move_data(stmt->ForStmt.body, ranged);
+
+	case Ast_RangeStmt:
+		return lb_range_expr_may_move_data(stmt->RangeStmt.expr, ranged) ||
+		       lb_range_body_may_move_data(stmt->RangeStmt.body, ranged);
+
+	case Ast_SwitchStmt:
+		return lb_range_body_may_move_data(stmt->SwitchStmt.init, ranged) ||
+		       lb_range_expr_may_move_data(stmt->SwitchStmt.tag, ranged) ||
+		       lb_range_body_may_move_data(stmt->SwitchStmt.body, ranged);
+
+	case Ast_CaseClause:
+		return lb_range_expr_list_may_move_data(stmt->CaseClause.list, ranged) ||
+		       lb_range_body_list_may_move_data(stmt->CaseClause.stmts, ranged);
+	}
+	return true;
+}
+
+// NOTE: The hashes are scanned in blocks of this many cells, which always divides the capacity of a
+// non-empty map (see MAP_MIN_LOG2_CAPACITY in base:runtime)
+gb_global i64 const LB_MAP_RANGE_BLOCK = 8;
+
+// NOTE: Reloads the map and its cell bases on every iteration, for bodies which may grow (and so reallocate) the map
+gb_internal void lb_build_range_map_reloading(lbProcedure *p, lbValue expr, Type *key_type, Type *val_type,
+                                              lbValue *val_, lbValue *key_, lbBlock **loop_, lbBlock **done_) {
 	lbModule *m = p->module;
 
 	Type *type = base_type(type_deref(expr.type));
 	GB_ASSERT(type->kind == Type_Map);
 
-	lbValue idx = {};
-	lbBlock *loop = nullptr;
-	lbBlock *done = nullptr;
-	lbBlock *body = nullptr;
-	lbBlock *hash_check = nullptr;
-
-
 	lbAddr index = lb_add_local_generated(p, t_int, false);
 	lb_addr_store(p, index, lb_const_int(m, t_int, cast(u64)-1));
 
-	loop = lb_create_block(p, "for.index.loop");
+	lbBlock *loop = lb_create_block(p, "for.index.loop");
 	lb_emit_jump(p, loop);
 	lb_start_block(p, loop);
 
 	lbValue incr = lb_emit_arith(p, Token_Add, lb_addr_load(p, index), lb_const_int(m, t_int, 1), t_int);
 	lb_addr_store(p, index, incr);
 
-	hash_check = lb_create_block(p, "for.index.hash_check");
-	body = lb_create_block(p, "for.index.body");
-	done = lb_create_block(p, "for.index.done");
+	lbBlock *hash_check = lb_create_block(p, "for.index.hash_check");
+	lbBlock *body = lb_create_block(p, "for.index.body");
+	lbBlock *done = lb_create_block(p, "for.index.done");
 
 	lbValue map_value = lb_emit_load(p, expr);
 	lbValue capacity = lb_map_cap(p, map_value);
-	lbValue cond = lb_emit_comp(p, Token_Lt, incr, capacity);
-	lb_emit_if(p, cond, hash_check, done);
+	lb_emit_if(p, lb_emit_comp(p, Token_Lt, incr, capacity), hash_check, done);
 	lb_start_block(p, hash_check);
 
-	idx = lb_addr_load(p, index);
+	lbValue idx = lb_addr_load(p, index);
 
 	lbValue ks = lb_map_data_uintptr(p, map_value);
 	lbValue vs = lb_emit_conv(p, lb_map_cell_index_static(p, type->Map.key, ks, capacity), alloc_type_pointer(type->Map.value));
 	lbValue hs = lb_emit_conv(p, lb_map_cell_index_static(p, type->Map.value, vs, capacity), alloc_type_pointer(t_uintptr));
 
-	// NOTE(bill): no need to use lb_map_cell_index_static for that hashes
-	// since it will always be packed without padding into the cells
 	lbValue hash = lb_emit_load(p, lb_emit_ptr_offset(p, hs, idx));
-
-	lbValue hash_cond = lb_map_hash_is_valid(p, hash);
-	lb_emit_if(p, hash_cond, body, loop);
+	lb_emit_if(p, lb_map_hash_is_valid(p, hash), body, loop);
 	lb_start_block(p, body);
 
+	if (key_type != nullptr) {
+		lbValue key_ptr = lb_map_cell_index_static(p, type->Map.key, ks, idx);
+		if (key_) *key_ = lb_emit_load(p, key_ptr);
+	}
+	if (val_type != nullptr) {
+		lbValue val_ptr = lb_map_cell_index_static(p, type->Map.value, vs, idx);
+		if (val_) *val_ = lb_emit_load(p, val_ptr);
+	}
+	if (loop_) *loop_ = loop;
+	if (done_) *done_ = done;
+}
+
+gb_internal void lb_build_range_map(lbProcedure *p, lbValue expr, Type *key_type, Type *val_type, bool may_grow,
+                                    lbValue *val_, lbValue *key_, lbBlock **loop_, lbBlock **done_) {
+	lbModule *m = p->module;
 
-	lbValue key_ptr = lb_map_cell_index_static(p, type->Map.key, ks, idx);
-	lbValue val_ptr = lb_map_cell_index_static(p, type->Map.value, vs, idx);
-	lbValue key = lb_emit_load(p, key_ptr);
-	lbValue val = lb_emit_load(p, val_ptr);
+	Type *type = base_type(type_deref(expr.type));
+	GB_ASSERT(type->kind == Type_Map);
 
-	if (val_)  *val_  = val;
-	if (key_)  *key_  = key;
+	if (may_grow) {
+		lb_build_range_map_reloading(p, expr, key_type, val_type, val_, key_, loop_, done_);
+		return;
+	}
+
+	/*
+		for key, value in m {
+			...
+		}
+
+		// the map and its cell bases are loaded once, as the body cannot grow the map
+		next, start, mask := 0, 0, u8(0)
+		for {
+			if mask == 0 {
+				if next >= cap(m) { break }
+				mask = valid_hash_mask(hashes[next:][:8])
+				start, next = next, next+8
+				continue
+			}
+			i := start + count_trailing_zeros(mask)
+			mask &= mask-1
+			if !valid_hash(hashes[i]) { continue } // deleted by an earlier iteration
+			...
+		}
+	*/
+
+	lbValue map_value = lb_emit_load(p, expr);
+	lbValue capacity = lb_map_cap(p, map_value);
+	lbValue ks = lb_map_data_uintptr(p, map_value);
+	lbValue vs = lb_emit_conv(p, lb_map_cell_index_static(p, type->Map.key, ks, capacity), alloc_type_pointer(type->Map.value));
+	lbValue hs = lb_emit_conv(p, lb_map_cell_index_static(p, type->Map.value, vs, capacity), alloc_type_pointer(t_uintptr));
+
+	lbAddr next_block  = lb_add_local_generated(p, t_int, false);
+	lbAddr block_start = lb_add_local_generated(p, t_int, false);
+	lbAddr block_mask  = lb_add_local_generated(p, t_u8, false);
+	lb_addr_store(p, next_block, lb_const_int(m, t_int, 0));
+	lb_addr_store(p, block_start, lb_const_int(m, t_int, 0));
+	lb_addr_store(p, block_mask, lb_const_int(m, t_u8, 0));
+
+	lbBlock *loop  = lb_create_block(p, "for.map.loop");
+	lbBlock *scan  = lb_create_block(p, "for.map.scan");
+	lbBlock *fetch = lb_create_block(p, "for.map.fetch");
+	lbBlock *take  = lb_create_block(p, "for.map.take");
+	lbBlock *body  = lb_create_block(p, "for.map.body");
+	lbBlock *done  = lb_create_block(p, "for.map.done");
+
+	lb_emit_jump(p, loop);
+	lb_start_block(p, loop);
+	lbValue zero_mask = lb_const_int(m, t_u8, 0);
+	lb_emit_if(p, lb_emit_comp(p, Token_NotEq, lb_addr_load(p, block_mask), zero_mask), take, scan);
+
+	lb_start_block(p, scan);
+	lbValue next = lb_addr_load(p, next_block);
+	lb_emit_if(p, lb_emit_comp(p, Token_Lt, next, capacity), fetch, done);
+
+	lb_start_block(p, fetch);
+	{
+		// NOTE(bill): no need to use lb_map_cell_index_static for that hashes
+		// since it will always be packed without padding into the cells
+		LLVMTypeRef hash_type = lb_type(m, t_uintptr);
+		LLVMTypeRef vector_type = LLVMVectorType(hash_type, cast(unsigned)LB_MAP_RANGE_BLOCK);
+		LLVMValueRef ptr = lb_emit_ptr_offset(p, hs, next).value;
+		ptr = LLVMBuildPointerCast(p->builder, ptr, LLVMPointerType(vector_type, 0), "");
+		LLVMValueRef hashes = LLVMBuildLoad2(p->builder, vector_type, ptr, "");
+		LLVMSetAlignment(hashes, cast(unsigned)type_align_of(t_uintptr));
+
+		LLVMValueRef top_bits[LB_MAP_RANGE_BLOCK] = {};
+		for (i64 i = 0; i < LB_MAP_RANGE_BLOCK; i++) {
+			top_bits[i] = LLVMConstInt(hash_type, cast(u64)(type_size_of(t_uintptr)*8 - 1), false);
+		}
+		LLVMValueRef zero = LLVMConstNull(vector_type);
+		LLVMValueRef not_empty = LLVMBuildICmp(p->builder, LLVMIntNE, hashes, zero, "");
+		LLVMValueRef deleted_bit = LLVMBuildLShr(p->builder, hashes, LLVMConstVector(top_bits, cast(unsigned)LB_MAP_RANGE_BLOCK), "");
+		LLVMValueRef not_deleted = LLVMBuildICmp(p->builder, LLVMIntEQ, deleted_bit, zero, "");
+		LLVMValueRef valid = LLVMBuildAnd(p->builder, not_empty, not_deleted, "");
+
+		lbValue mask = {};
+		mask.value = LLVMBuildBitCast(p->builder, valid, lb_type(m, t_u8), "");
+		mask.type = t_u8;
+		lb_addr_store(p, block_mask, mask);
+		lb_addr_store(p, block_start, next);
+		lb_addr_store(p, next_block, lb_emit_arith(p, Token_Add, next, lb_const_int(m, t_int, LB_MAP_RANGE_BLOCK), t_int));
+	}
+	lb_emit_jump(p, loop);
+
+	lb_start_block(p, take);
+	lbValue mask = lb_addr_load(p, block_mask);
+	lbValue bit = lb_emit_conv(p, lb_emit_count_trailing_zeros(p, mask, t_u8), t_int);
+	if (build_context.endian_kind == TargetEndian_Big) {
+		// the first lane of the bitcast mask is its most significant bit
+		bit = lb_emit_arith(p, Token_Sub, lb_const_int(m, t_int, LB_MAP_RANGE_BLOCK-1), bit, t_int);
+	}
+	lbValue rest = lb_emit_arith(p, Token_Sub, mask, lb_const_int(m, t_u8, 1), t_u8);
+	lb_addr_store(p, block_mask, lb_emit_arith(p, Token_And, mask, rest, t_u8));
+	lbValue idx = lb_emit_arith(p, Token_Add, lb_addr_load(p, block_start), bit, t_int);
+
+	// NOTE: The body may have deleted a later entry of the same block
+	lbValue hash = lb_emit_load(p, lb_emit_ptr_offset(p, hs, idx));
+	lb_emit_if(p, lb_map_hash_is_valid(p, hash), body, loop);
+	lb_start_block(p, body);
+
+	if (key_type != nullptr) {
+		lbValue key_ptr = lb_map_cell_index_static(p, type->Map.key, ks, idx);
+		if (key_) *key_ = lb_emit_load(p, key_ptr);
+	}
+	if (val_type != nullptr) {
+		lbValue val_ptr = lb_map_cell_index_static(p, type->Map.value, vs, idx);
+		if (val_) *val_ = lb_emit_load(p, val_ptr);
+	}
 	if (loop_) *loop_ = loop;
 	if (done_) *done_ = done;
 }
@@ -635,6 +955,80 @@ gb_internal Ast *lb_strip_and_prefix(Ast *ident) {
 
 
 
+gb_internal Entity *lb_range_bound_value_entity(Ast *expr) {
+	expr = unparen_expr(expr);
+	if (expr == nullptr || expr->kind != Ast_Ident) {
+		return nullptr;
+	}
+	Entity *e = entity_of_node(expr);
+	if (e == nullptr || e->kind != Entity_Variable) {
+		return nullptr;
+	}
+	// NOTE: Only immutable values (parameters, range values, etc) can be relied upon to keep their length
+	if ((e->flags & EntityFlag_Value) == 0 || (e->flags & EntityFlag_ByPtr) != 0) {
+		return nullptr;
+	}
+	return e;
+}
+
+gb_internal void lb_push_range_index_bound(lbProcedure *p, Ast *index, Ast *array, i64 count) {
+	lbRangeIndexBound bound = {};
+	bound.index = lb_range_bound_value_entity(index);
+	if (bound.index == nullptr || !is_type_integer(bound.index->type)) {
+		return;
+	}
+	if (array != nullptr) {
+		Type *t = type_of_expr(array);
+		if (!is_type_slice(t) && !is_type_string(t)) {
+			return;
+		}
+		bound.array = lb_range_bound_value_entity(array);
+		if (bound.array == nullptr) {
+			return;
+		}
+	} else if (count <= 0) {
+		return;
+	}
+	bound.count = count;
+	array_add(&p->range_index_bounds, bound);
+}
+
+// NOTE: Returns true if `index` is the index of an enclosing range loop which is known to be in bounds of
+// either `array` or anything with at least `count` elements
+gb_internal bool lb_is_range_index_in_bounds(lbProcedure *p, Ast *index, Ast *array, i64 count) {
+	if (p->range_index_bounds.count == 0) {
+		return false;
+	}
+	index = unparen_expr(index);
+	if (index == nullptr || index->kind != Ast_Ident) {
+		return false;
+	}
+	Entity *e = entity_of_node(index);
+	if (e == nullptr) {
+		return false;
+	}
+	Entity *a = nullptr;
+	if (array != nullptr) {
+		array = unparen_expr(array);
+		if (array->kind == Ast_Ident) {
+			a = entity_of_node(array);
+		}
+	}
+	for (lbRangeIndexBound const &bound : p->range_index_bounds) {
+		if (bound.index != e) {
+			continue;
+		}
+		if (bound.array != nullptr) {
+			if (bound.array == a) {
+				return true;
+			}
+		} else if (count > 0 && bound.count <= count) {
+			return true;
+		}
+	}
+	return false;
+}
+
 gb_internal void lb_build_range_interval(lbProcedure *p, AstBinaryExpr *node,
                                          AstRangeStmt *rs, Scope *scope) {
 	bool ADD_EXTRA_WRAPPING_CHECK = true;
@@ -729,7 +1123,26 @@ gb_internal void lb_build_range_interval(lbProcedure *p, AstBinaryExpr *node,
 
 		lb_push_target_list(p, rs->label, done, continue_block, nullptr);
 
+		isize prev_range_index_bounds_count = p->range_index_bounds.count;
+		if (val0_type != nullptr && op == Token_Lt && node->op.kind == Token_RangeHalf) {
+			TypeAndValue lo = type_and_value_of_expr(node->left);
+			TypeAndValue hi = type_and_value_of_expr(node->right);
+			if (lo.mode == Addressing_Constant && lo.value.kind == ExactValue_Integer && big_int_is_neg(&lo.value.value_integer) == false) {
+				Ast *hi_expr = unparen_expr(node->right);
+				if (hi.mode == Addressing_Constant && hi.value.kind == ExactValue_Integer) {
+					lb_push_range_index_bound(p, val0, nullptr, exact_value_to_i64(hi.value));
+				} else if (hi_expr->kind == Ast_CallExpr && hi_expr->CallExpr.args.count == 1) {
+					Ast *proc = unparen_expr(hi_expr->CallExpr.proc);
+					Entity *len = proc->tav.mode == Addressing_Builtin ? entity_of_node(proc) : nullptr;
+					if (len != nullptr && len->Builtin.id == BuiltinProc_len) {
+						lb_push_range_index_bound(p, val0, hi_expr->CallExpr.args[0], 0);
+					}
+				}
+			}
+		}
+
 		lb_build_stmt(p, rs->body);
+		p->range_index_bounds.count = prev_range_index_bounds_count;
 
 		lb_close_scope(p, lbDeferExit_Default, nullptr, node->left);
 		lb_pop_target_list(p);
@@ -870,6 +1283,18 @@ gb_internal void lb_build_range_tuple(lbProcedure *p, AstRangeStmt *rs, Scope *s
 	lb_start_block(p, done);
 }
 
+gb_internal void lb_emit_soa_loop_entry(lbProcedure *p, lbBlock *loop, lbSoaColumns **columns) {
+	lbBlock *entry = p->curr_block;
+	lb_emit_jump(p, loop);
+	if (*columns != nullptr) {
+		if (entry != nullptr) {
+			(*columns)->loop_entry = LLVMGetBasicBlockTerminator(entry->block);
+		} else {
+			*columns = nullptr;
+		}
+	}
+}
+
 gb_internal void lb_build_range_stmt_struct_soa(lbProcedure *p, AstRangeStmt *rs, Scope *scope) {
 	Ast *expr = unparen_expr(rs->expr);
 	TypeAndValue tav = type_and_value_of_expr(expr);
@@ -904,6 +1329,21 @@ gb_internal void lb_build_range_stmt_struct_soa(lbProcedure *p, AstRangeStmt *rs
 
 	lbAddr index = lb_add_local_generated(p, t_int, false);
 
+	// NOTE: The column base pointers are only hoisted out of the loop when the #soa value is a variable
+	// which the body provably cannot change, otherwise every access reloads them from the header
+	Entity *array_entity = nullptr;
+	if (expr->kind == Ast_Ident && !is_type_pointer(tav.type)) {
+		array_entity = entity_of_node(expr);
+	}
+
+	lbSoaColumns *columns = nullptr;
+	if (base_type(type_deref(array.addr.type))->Struct.soa_kind != StructSoa_Fixed &&
+	    array_entity != nullptr && array_entity->kind == Entity_Variable &&
+	    !lb_range_body_may_move_data(rs->body, array_entity)) {
+		columns = gb_alloc_item(permanent_allocator(), lbSoaColumns);
+		columns->bases = slice_make<lbValue>(permanent_allocator(), base_type(type_deref(array.addr.type))->Struct.fields.count);
+	}
+
 	if (rs->label != nullptr && p->debug_info != nullptr) {
 		lbBlock *label = lb_create_block(p, "for.soa.label");
 		lb_emit_jump(p, label);
@@ -932,7 +1372,7 @@ gb_internal void lb_build_range_stmt_struct_soa(lbProcedure *p, AstRangeStmt *rs
 		lb_addr_store(p, index, lb_const_int(p->module, t_int, cast(u64)-1));
 
 		loop = lb_create_block(p, "for.soa.loop");
-		lb_emit_jump(p, loop);
+		lb_emit_soa_loop_entry(p, loop, &columns);
 		lb_start_block(p, loop);
 
 		lbValue incr = lb_emit_arith(p, Token_Add, lb_addr_load(p, index), lb_const_int(p->module, t_int, 1), t_int);
@@ -963,7 +1403,7 @@ gb_internal void lb_build_range_stmt_struct_soa(lbProcedure *p, AstRangeStmt *rs
 		lb_addr_store(p, index, count);
 
 		loop = lb_create_block(p, "for.soa.loop");
-		lb_emit_jump(p, loop);
+		lb_emit_soa_loop_entry(p, loop, &columns);
 		lb_start_block(p, loop);
 
 		lbValue incr = lb_emit_arith(p, Token_Sub, lb_addr_load(p, index), lb_const_int(p->module, t_int, 1), t_int);
@@ -982,6 +1422,7 @@ gb_internal void lb_build_range_stmt_struct_soa(lbProcedure *p, AstRangeStmt *rs
 		Entity *e = entity_of_node(val0);
 		if (e != nullptr) {
 			lbAddr soa_val = lb_addr_soa_variable(array.addr, lb_addr_load(p, index), nullptr);
+			soa_val.soa.columns = columns;
 			map_set(&p->module->soa_values, e, soa_val);
 		}
 	}
@@ -1068,7 +1509,15 @@ gb_internal void lb_build_range_stmt(lbProcedure *p, AstRangeStmt *rs, Scope *sc
 			if (is_type_pointer(type_deref(map.type))) {
 				map = lb_emit_load(p, map);
 			}
-			lb_build_range_map(p, map, val1_type, &val, &key, &loop, &done);
+			// NOTE: The block scan addresses the cells from bases loaded at loop entry, which is only valid
+			// when the body provably cannot insert into the map and reallocate them
+			Entity *map_entity = nullptr;
+			if (expr->kind == Ast_Ident && !is_type_pointer(expr_type)) {
+				map_entity = entity_of_node(expr);
+			}
+			bool may_grow = map_entity == nullptr || map_entity->kind != Entity_Variable ||
+			                lb_range_body_may_move_data(rs->body, map_entity);
+			lb_build_range_map(p, map, val0_type, val1_type, may_grow, &val, &key, &loop, &done);
 			break;
 		}
 		case Type_Array: {
@@ -1209,7 +1658,18 @@ gb_internal void lb_build_range_stmt(lbProcedure *p, AstRangeStmt *rs, Scope *sc
 
 	lb_push_target_list(p, rs->label, done, loop, nullptr);
 
+	isize prev_range_index_bounds_count = p->range_index_bounds.count;
+	if (!is_map && val1_type != nullptr && tav.mode != Addressing_Type) {
+		Type *et = base_type(type_deref(type_of_expr(expr)));
+		if (et->kind == Type_Array) {
+			lb_push_range_index_bound(p, val1, nullptr, et->Array.count);
+		} else if (et->kind == Type_Slice || is_type_string(et)) {
+			lb_push_range_index_bound(p, val1, expr, 0);
+		}
+	}
+
 	lb_build_stmt(p, rs->body);
+	p->range_index_bounds.count = prev_range_index_bounds_count;
 
 	lb_close_scope(p, lbDeferExit_Default, nullptr, rs->body);
 	lb_pop_target_list(p);
@@ -1566,6 +2026,152 @@ gb_internal bool lb_switch_stmt_can_be_trivial_jump_table(AstSwitchStmt *ss, boo
 }
 
 
+// NOTE: Ranges covering at most this many values are expanded into individual switch cases, which LLVM
+// can cluster into jump tables, bit tests or its own search tree. Wider ranges become explicit comparisons.
+gb_global u64 const LB_SWITCH_RANGE_EXPAND_MAX = 64;
+
+struct lbSwitchInterval {
+	u64      lo, hi; // inclusive, biased for signed tags so that unsigned ordering matches the tag's ordering
+	lbBlock *target;
+};
+
+gb_internal GB_COMPARE_PROC(lb_switch_interval_cmp) {
+	u64 x = (cast(lbSwitchInterval const *)a)->lo;
+	u64 y = (cast(lbSwitchInterval const *)b)->lo;
+	return x < y ? -1 : x > y;
+}
+
+gb_internal bool lb_switch_case_value(Ast *expr, bool is_signed, u64 *value_) {
+	if (expr->tav.mode != Addressing_Constant || expr->tav.value.kind != ExactValue_Integer) {
+		return false;
+	}
+	if (is_signed) {
+		*value_ = cast(u64)exact_value_to_i64(expr->tav.value) + (1ull<<63);
+	} else {
+		*value_ = exact_value_to_u64(expr->tav.value);
+	}
+	return true;
+}
+
+// Collects the cases of an integer (or integer-backed enum) switch with constant ranges as sorted, non-overlapping intervals.
+// Anything else (overlaps, non-constant cases, 128-bit tags) keeps the first-match chain of comparisons.
+gb_internal bool lb_switch_stmt_intervals(AstSwitchStmt *ss, Slice<lbBlock *> const &body_blocks, Array<lbSwitchInterval> *intervals) {
+	if (ss->tag == nullptr) {
+		return false;
+	}
+	Type *tag_type = core_type(type_of_expr(ss->tag));
+	if (tag_type->kind == Type_Enum) {
+		tag_type = core_type(tag_type->Enum.base_type);
+	}
+	if (!is_type_integer(tag_type) || type_size_of(tag_type) > 8) {
+		return false;
+	}
+	bool is_signed = !is_type_unsigned(tag_type);
+
+	bool has_range = false;
+	ast_node(body, BlockStmt, ss->body);
+	for_array(i, body->stmts) {
+		ast_node(cc, CaseClause, body->stmts[i]);
+		for (Ast *expr : cc->list) {
+			expr = unparen_expr(expr);
+			lbSwitchInterval interval = {};
+			interval.target = body_blocks[i];
+			if (is_ast_range(expr)) {
+				ast_node(ie, BinaryExpr, expr);
+				if (!lb_switch_case_value(ie->left,  is_signed, &interval.lo) ||
+				    !lb_switch_case_value(ie->right, is_signed, &interval.hi)) {
+					return false;
+				}
+				if (ie->op.kind == Token_RangeHalf) {
+					if (interval.hi <= interval.lo) {
+						continue;
+					}
+					interval.hi -= 1;
+				}
+				if (interval.hi < interval.lo) {
+					continue;
+				}
+				has_range = true;
+			} else {
+				if (!lb_switch_case_value(expr, is_signed, &interval.lo)) {
+					return false;
+				}
+				interval.hi = interval.lo;
+			}
+			array_add(intervals, interval);
+		}
+	}
+	if (!has_range) {
+		return false;
+	}
+
+	array_sort(*intervals, lb_switch_interval_cmp);
+	for (isize i = 1; i < intervals->count; i++) {
+		if ((*intervals)[i].lo <= (*intervals)[i-1].hi) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Splits on the wide interval nearest the middle, so the comparisons form a balanced tree,
+// and emits a single switch once only expandable intervals remain
+gb_internal void lb_build_switch_intervals(lbProcedure *p, lbValue tag, bool is_signed, Slice<lbSwitchInterval> intervals, lbBlock *fallback) {
+	u64 bias = is_signed ? (1ull<<63) : 0;
+
+	isize wide = -1;
+	for_array(i, intervals) {
+		if (intervals[i].hi - intervals[i].lo >= LB_SWITCH_RANGE_EXPAND_MAX) {
+			if (wide < 0 || gb_abs(i - intervals.count/2) < gb_abs(wide - intervals.count/2)) {
+				wide = i;
+			}
+		}
+	}
+
+	if (wide < 0) {
+		if (intervals.count == 0) {
+			lb_emit_jump(p, fallback);
+			return;
+		}
+		u64 case_count = 0;
+		for (lbSwitchInterval const &interval : intervals) {
+			case_count += interval.hi - interval.lo + 1;
+		}
+		LLVMValueRef switch_instr = LLVMBuildSwitch(p->builder, tag.value, fallback->block, cast(unsigned)case_count);
+		for (lbSwitchInterval const &interval : intervals) {
+			for (u64 k = 0; k <= interval.hi - interval.lo; k++) {
+				lbValue on_val = lb_const_int(p->module, tag.type, interval.lo + k - bias);
+				LLVMAddCase(switch_instr, on_val.value, interval.target->block);
+			}
+		}
+		p->curr_block = nullptr;
+		return;
+	}
+
+	lbSwitchInterval const &w = intervals[wide];
+	lbValue lo = lb_const_int(p->module, tag.type, w.lo - bias);
+	lbValue hi = lb_const_int(p->module, tag.type, w.hi - bias);
+
+	// NOTE: Bounds at the extremes of the tag's type need no comparison
+	if (w.lo != 0) {
+		lbBlock *below = lb_create_block(p, "switch.range.below");
+		lbBlock *not_below = lb_create_block(p, "switch.range.not_below");
+		lb_emit_if(p, lb_emit_comp(p, Token_Lt, tag, lo), below, not_below);
+		lb_start_block(p, below);
+		lb_build_switch_intervals(p, tag, is_signed, slice(intervals, 0, wide), fallback);
+		lb_start_block(p, not_below);
+	}
+	if (w.hi == U64_MAX) {
+		lb_emit_jump(p, w.target);
+		return;
+	}
+
+	lbBlock *above = lb_create_block(p, "switch.range.above");
+	lb_emit_if(p, lb_emit_comp(p, Token_LtEq, tag, hi), w.target, above);
+	lb_start_block(p, above);
+	lb_build_switch_intervals(p, tag, is_signed, slice(intervals, wide+1, intervals.count), fallback);
+}
+
 gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *scope) {
 	lb_open_scope(p, scope);
 
@@ -1611,6 +2217,7 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 
 
 	LLVMValueRef switch_instr = nullptr;
+	bool is_dispatched = false; // every case is reached through a switch or a decision tree rather than a chain
 	if (is_trivial) {
 		isize num_cases = 0;
 		for (Ast *clause : body->stmts) {
@@ -1624,6 +2231,16 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 		}
 
 		switch_instr = LLVMBuildSwitch(p->builder, tag.value, end_block, cast(unsigned)num_cases);
+		is_dispatched = true;
+	} else {
+		TEMPORARY_ALLOCATOR_GUARD();
+		auto intervals = array_make<lbSwitchInterval>(temporary_allocator());
+		if (lb_switch_stmt_intervals(ss, body_blocks, &intervals)) {
+			lbBlock *fallback = default_block != nullptr ? default_block : done;
+			bool is_signed = !is_type_unsigned(core_type(tag.type));
+			lb_build_switch_intervals(p, tag, is_signed, slice(intervals, 0, intervals.count), fallback);
+			is_dispatched = true;
+		}
 	}
 
 
@@ -1642,7 +2259,7 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 			default_clause = clause;
 			default_stmts = cc->stmts;
 			default_fall  = fall;
-			if (switch_instr == nullptr) {
+			if (!is_dispatched) {
 				default_block = body;
 			} else {
 				GB_ASSERT(default_block != nullptr);
@@ -1672,6 +2289,9 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 				LLVMAddCase(switch_instr, on_val.value, body->block);
 				continue;
 			}
+			if (is_dispatched) {
+				continue;
+			}
 
 			next_cond = lb_create_block(p, "switch.case.next");
 
@@ -1714,13 +2334,13 @@ gb_internal void lb_build_switch_stmt(lbProcedure *p, AstSwitchStmt *ss, Scope *
 		lb_pop_target_list(p);
 
 		lb_emit_jump(p, done);
-		if (switch_instr == nullptr) {
+		if (!is_dispatched) {
 			lb_start_block(p, next_cond);
 		}
 	}
 
 	if (default_block != nullptr) {
-		if (switch_instr == nullptr) {
+		if (!is_dispatched) {
 			lb_emit_jump(p, default_block);
 		}
 		lb_start_block(p, default_block);
@@ -2039,7 +2659,7 @@ gb_internal void lb_build_static_variables(lbProcedure *p, AstValueDecl *vd) {
 			LLVMSetGlobalConstant(global, true);
 		}
 
-		if (!lb_apply_thread_local_model(global, e->Variable.thread_local_model)) {
+		if (!lb_apply_thread_local_model(global, entity_cold(e)->thread_local_model)) {
 			LLVMSetLinkage(global, LLVMInternalLinkage);
 		}
 
@@ -2057,7 +2677,7 @@ gb_internal void lb_build_static_variables(lbProcedure *p, AstValueDecl *vd) {
 					LLVMSetGlobalConstant(var_global_ref, true);
 				}
 				
-				if (!lb_apply_thread_local_model(var_global_ref, e->Variable.thread_local_model)) {
+				if (!lb_apply_thread_local_model(var_global_ref, entity_cold(e)->thread_local_model)) {
 					LLVMSetLinkage(var_global_ref, LLVMInternalLinkage);
 				}
 
@@ -2638,6 +3258,9 @@ gb_internal void lb_build_assign_stmt_array(lbProcedure *p, TokenKind op, lbAddr
 		for (unsigned i = 0; i < n; i++) {
 			lb_emit_store(p, lhs_ptrs[i], ops[i]);
 		}
+	} else if (lb_can_chunk_array_arith(op, array_type)) {
+		lbValue y = lb_address_from_load_or_generate_local(p, rhs);
+		lb_emit_array_arith_chunked(p, op, x, x, y, array_type);
 	} else {
 		lbValue y = lb_address_from_load_or_generate_local(p, rhs);
 
@@ -2654,8 +3277,51 @@ gb_internal void lb_build_assign_stmt_array(lbProcedure *p, TokenKind op, lbAddr
 		lb_loop_end(p, loop_data);
 	}
 }
+
+// NOTE: `c = a op b` on large arrays of variables writes straight into `c` rather than through a temporary
+gb_internal bool lb_build_assign_array_arith_in_place(lbProcedure *p, Ast *lhs, Ast *rhs) {
+	lhs = unparen_expr(lhs);
+	rhs = unparen_expr(rhs);
+	if (lhs->kind != Ast_Ident || rhs->kind != Ast_BinaryExpr) {
+		return false;
+	}
+	Type *type = type_of_expr(rhs);
+	if (type == nullptr || !is_type_array(type) || lb_can_try_to_inline_array_arith(type)) {
+		return false;
+	}
+	TokenKind op = rhs->BinaryExpr.op.kind;
+	if (!lb_can_chunk_array_arith(op, type)) {
+		return false;
+	}
+
+	Ast *operands[3] = {lhs, unparen_expr(rhs->BinaryExpr.left), unparen_expr(rhs->BinaryExpr.right)};
+	for (Ast *operand : operands) {
+		if (operand->kind != Ast_Ident) {
+			return false;
+		}
+		Entity *e = entity_of_node(operand);
+		if (e == nullptr || e->kind != Entity_Variable || (e->flags & EntityFlag_Using) != 0) {
+			return false;
+		}
+		if (!are_types_identical(type_of_expr(operand), type)) {
+			return false;
+		}
+	}
+
+	lbValue dst = lb_build_addr_ptr(p, operands[0]);
+	lbValue x = lb_build_addr_ptr(p, operands[1]);
+	lbValue y = lb_build_addr_ptr(p, operands[2]);
+	lb_emit_array_arith_chunked(p, op, dst, x, y, type);
+	return true;
+}
+
 gb_internal void lb_build_assign_stmt(lbProcedure *p, AstAssignStmt *as) {
 	if (as->op.kind == Token_Eq) {
+		if (as->lhs.count == 1 && as->rhs.count == 1 &&
+		    lb_build_assign_array_arith_in_place(p, as->lhs[0], as->rhs[0])) {
+			return;
+		}
+
 		auto lvals = array_make<lbAddr>(permanent_allocator(), 0, as->lhs.count);
 
 		for (Ast *lhs : as->lhs) {
@@ -2836,7 +3502,7 @@ gb_internal void lb_build_stmt(lbProcedure *p, Ast *node) {
 				if (!is_blank_ident(name)) {
 					Entity *e = entity_of_node(name);
 					// bool zero_init = true; // Always do it
-					bool zero_init = values.count == 0;
+					bool zero_init = e->Variable.zero_init != VariableZeroInit_Elided;
 					lvals[i] = lb_add_local(p, e->type, e, zero_init);
 				}
 			}
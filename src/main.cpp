@@ -26,16 +26,38 @@ gb_internal void thread_pool_wait(void) {
 }
 
 
+#if defined(GB_SYSTEM_UNIX) || defined(GB_SYSTEM_OSX)
+#include <sys/resource.h>
+#endif
+
+// NOTE: returns 0 if the peak resident set size is not known on this platform
+gb_internal i64 get_peak_memory_usage(void) {
+#if defined(GB_SYSTEM_WINDOWS)
+	PROCESS_MEMORY_COUNTERS p = {sizeof(p)};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &p, sizeof(p))) {
+		return cast(i64)p.PeakWorkingSetSize;
+	}
+#elif defined(GB_SYSTEM_UNIX) || defined(GB_SYSTEM_OSX)
+	struct rusage usage = {};
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+	#if defined(GB_SYSTEM_OSX)
+		return cast(i64)usage.ru_maxrss; // bytes
+	#else
+		return cast(i64)usage.ru_maxrss * 1024; // kibibytes
+	#endif
+	}
+#endif
+	return 0;
+}
+
 gb_internal i64 PRINT_PEAK_USAGE(void) {
 	if (build_context.show_more_timings) {
-	#if defined(GB_SYSTEM_WINDOWS)
-		PROCESS_MEMORY_COUNTERS p = {sizeof(p)};
-		if (GetProcessMemoryInfo(GetCurrentProcess(), &p, sizeof(p))) {
+		i64 peak = get_peak_memory_usage();
+		if (peak != 0) {
 			gb_printf("\n");
-			gb_printf("Peak Memory Size: %.3f MiB\n", (cast(f64)p.PeakWorkingSetSize) / cast(f64)(1024ull * 1024ull));
-			return cast(i64)p.PeakWorkingSetSize;
+			gb_printf("Peak Memory Size: %.3f MiB\n", (cast(f64)peak) / cast(f64)(1024ull * 1024ull));
 		}
-	#endif
+		return peak;
 	}
 	return 0;
 }
@@ -401,6 +423,7 @@ enum BuildFlagKind {
 	BuildFlag_InternalCached,
 	BuildFlag_InternalNoInline,
 	BuildFlag_InternalByValue,
+	BuildFlag_InternalStreamTokens,
 
 	BuildFlag_Tilde,
 
@@ -621,6 +644,7 @@ gb_internal bool parse_build_flags(Array<String> args) {
 	add_flag(&build_flags, BuildFlag_InternalCached,          str_lit("internal-cached"),           BuildFlagParam_None,    Command_all);
 	add_flag(&build_flags, BuildFlag_InternalNoInline,        str_lit("internal-no-inline"),        BuildFlagParam_None,    Command_all);
 	add_flag(&build_flags, BuildFlag_InternalByValue,         str_lit("internal-by-value"),         BuildFlagParam_None,    Command_all);
+	add_flag(&build_flags, BuildFlag_InternalStreamTokens,    str_lit("internal-stream-tokens"),    BuildFlagParam_None,    Command__does_check);
 
 #if ALLOW_TILDE
 	add_flag(&build_flags, BuildFlag_Tilde,                   str_lit("tilde"),                     BuildFlagParam_None,    Command__does_build);
@@ -1565,6 +1589,9 @@ gb_internal bool parse_build_flags(Array<String> args) {
 						case BuildFlag_InternalByValue:
 							build_context.internal_by_value = true;
 							break;
+						case BuildFlag_InternalStreamTokens:
+							build_context.internal_stream_tokens = true;
+							break;
 
 						case BuildFlag_Tilde:
 							build_context.tilde_backend = true;
@@ -1819,6 +1846,9 @@ gb_internal void timings_export_all(Timings *t, Checker *c, bool timings_are_fin
 		gb_fprintf(&f, "\t\t{\"name\": \"total_lines\",     \"count\": %td},\n", lines);
 		gb_fprintf(&f, "\t\t{\"name\": \"total_tokens\",    \"count\": %td},\n", tokens);
 		gb_fprintf(&f, "\t\t{\"name\": \"total_file_size\", \"count\": %td},\n", total_file_size);
+		gb_fprintf(&f, "\t\t{\"name\": \"excluded_files\",  \"count\": %td},\n", p->total_excluded_file_count.load());
+		gb_fprintf(&f, "\t\t{\"name\": \"thread_count\",    \"count\": %td},\n", build_context.thread_count);
+		gb_fprintf(&f, "\t\t{\"name\": \"peak_memory\",     \"count\": %lld}\n", cast(long long)get_peak_memory_usage());
 
 		gb_fprintf(&f, "\t],\n");
 
@@ -1827,16 +1857,31 @@ gb_internal void timings_export_all(Timings *t, Checker *c, bool timings_are_fin
 		t->total_time_seconds = time_stamp_as_s(t->total, t->freq);
 		f64 total_time = time_stamp(t->total, t->freq, unit);
 
-		gb_fprintf(&f, "\t\t{\"name\": \"%.*s\", \"millis\": %.3f},\n",
+		gb_fprintf(&f, "\t\t{\"name\": \"%.*s\", \"millis\": %.3f}",
 		    LIT(t->total.label), total_time);
 
 		for (TimeStamp const &ts : t->sections) {
 			f64 section_time = time_stamp(ts, t->freq, unit);
-			gb_fprintf(&f, "\t\t{\"name\": \"%.*s\", \"millis\": %.3f},\n",
+			gb_fprintf(&f, ",\n\t\t{\"name\": \"%.*s\", \"millis\": %.3f}",
 			    LIT(ts.label), section_time);
 		}
 
-		gb_fprintf(&f, "\t],\n");
+		gb_fprintf(&f, "\n\t],\n");
+
+		gb_fprintf(&f, "\t\"memory\": [");
+		bool first_memory_entry = true;
+		for (TimeStamp const &ts : t->sections) {
+			for (isize tag = 0; tag < MemoryTag_COUNT; tag++) {
+				if (ts.memory_current[tag] == 0 && ts.memory_peak[tag] == 0) {
+					continue;
+				}
+				gb_fprintf(&f, "%s\n\t\t{\"section\": \"%.*s\", \"tag\": \"%s\", \"current\": %lld, \"peak\": %lld}",
+				    first_memory_entry ? "" : ",", LIT(ts.label), memory_tag_names[tag],
+				    cast(long long)ts.memory_current[tag], cast(long long)ts.memory_peak[tag]);
+				first_memory_entry = false;
+			}
+		}
+		gb_fprintf(&f, "\n\t]\n");
 
 		gb_fprintf(&f, "}\n");
 	} else if (build_context.export_timings_format == TimingsExportCSV) {
@@ -1986,6 +2031,34 @@ gb_internal void show_defineables(Checker *c) {
 	}
 }
 
+gb_internal void print_entity_memory_usage(void) {
+	isize const entity_size = gb_size_of(Entity);
+	isize const cold_size   = gb_size_of(EntityCold);
+	char const SPACES[] = "                ";
+	int const label_width = gb_size_of(SPACES)-1;
+
+	auto print_row = [&](String label, isize count, isize bytes) {
+		gb_printf_err("%.*s%.*s - %9td - % 10.3f KiB\n",
+		              LIT(label), cast(int)(label_width-label.len), SPACES,
+		              count, cast(f64)bytes/1024.0);
+	};
+
+	gb_printf_err("\n");
+	gb_printf_err("Entity Memory (%td bytes per entity, %td bytes per out-of-line block)\n", entity_size, cold_size);
+
+	isize total_count = 0;
+	for (isize kind = 0; kind < Entity_Count; kind++) {
+		isize count = global_entity_kind_counts[kind].load(std::memory_order_relaxed);
+		if (count != 0) {
+			print_row(entity_strings[kind], count, count*entity_size);
+			total_count += count;
+		}
+	}
+	isize cold_count = global_entity_cold_count.load(std::memory_order_relaxed);
+	print_row(str_lit("(out-of-line)"), cold_count, cold_count*cold_size);
+	print_row(str_lit("Total"), total_count, total_count*entity_size + cold_count*cold_size);
+}
+
 gb_internal void show_timings(Checker *c, Timings *t) {
 	Parser *p      = c->parser;
 	isize lines    = p->total_line_count;
@@ -2007,6 +2080,12 @@ gb_internal void show_timings(Checker *c, Timings *t) {
 	timings_print_all(t);
 
 	PRINT_PEAK_USAGE();
+	if (build_context.show_more_timings) {
+		gb_printf_err("\n");
+		gb_printf_err("Files parsed                      - %td\n", files);
+		gb_printf_err("Files excluded before tokenizing  - %td\n", p->total_excluded_file_count.load());
+		print_entity_memory_usage();
+	}
 
 	if (!(build_context.export_timings_format == TimingsExportUnspecified)) {
 		timings_export_all(t, c, true);
@@ -3565,6 +3644,7 @@ int main(int arg_count, char const **arg_ptr) {
 	if (!parse_build_flags(args)) {
 		return 1;
 	}
+	global_memory_tags_enabled = build_context.show_timings;
 
 	if (build_context.show_help) {
 		return print_show_help(args[0], command);
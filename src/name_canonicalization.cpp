@@ -425,8 +425,9 @@ gb_internal void write_canonical_entity_name(TypeWriter *w, Entity *e) {
 	if (e->kind == Entity_Variable) {
 		bool is_foreign = e->Variable.is_foreign;
 		bool is_export  = e->Variable.is_export;
-		if (e->Variable.link_name.len > 0) {
-			type_writer_append(w, e->Variable.link_name.text, e->Variable.link_name.len);
+		String link_name = entity_cold(e)->link_name;
+		if (link_name.len > 0) {
+			type_writer_append(w, link_name.text, link_name.len);
 			return;
 		} else if (is_foreign || is_export) {
 			type_writer_append(w, e->token.string.text, e->token.string.len);
@@ -134,8 +134,6 @@ gb_internal isize ast_node_size(AstKind kind) {
 
 }
 
-// gb_global std::atomic<isize> global_total_node_memory_allocated;
-
 // NOTE(bill): And this below is why is I/we need a new language! Discriminated unions are a pain in C/C++
 gb_internal Ast *alloc_ast_node(AstFile *f, AstKind kind) {
 	isize size = ast_node_size(kind);
@@ -144,7 +142,7 @@ gb_internal Ast *alloc_ast_node(AstFile *f, AstKind kind) {
 	node->kind = kind;
 	node->file_id = f ? f->id : 0;
 
-	// global_total_node_memory_allocated.fetch_add(size);
+	memory_tag_add(MemoryTag_Ast, size);
 
 	return node;
 }
@@ -1381,9 +1379,103 @@ gb_internal Ast *ast_attribute(AstFile *f, Token token, Token open, Token close,
 }
 
 
+enum {
+	TOKEN_RING_INITIAL_CAPACITY = 1024,
+	STREAM_TOKENS_MIN_FILE_SIZE = 1024*1024,
+};
+
+gb_internal gb_inline bool ast_file_streams_tokens(AstFile *f) {
+	return f->token_ring.data != nullptr;
+}
+
+gb_internal void token_ring_resize(TokenRing *r, isize new_capacity) {
+	Token *data = gb_alloc_array(heap_allocator(), Token, new_capacity);
+	for (isize i = r->start; i < r->end; i++) {
+		data[i & (new_capacity-1)] = r->data[i & (r->capacity-1)];
+	}
+	memory_tag_add(MemoryTag_Tokens, (new_capacity - r->capacity)*gb_size_of(Token));
+	gb_free(heap_allocator(), r->data);
+	r->data = data;
+	r->capacity = new_capacity;
+}
+
+gb_internal void token_ring_destroy(TokenRing *r) {
+	memory_tag_add(MemoryTag_Tokens, -r->capacity*gb_size_of(Token));
+	gb_free(heap_allocator(), r->data);
+	r->data = nullptr;
+	r->capacity = 0;
+}
+
+// NOTE: Tokenizes until the ring is full or the end of the file, making sure `index` is held
+gb_internal void token_ring_fill(AstFile *f, isize index) {
+	TokenRing *r = &f->token_ring;
+	r->start = gb_clamp(f->prev_token_index, r->start, r->end);
+	if (index - r->start >= r->capacity) {
+		token_ring_resize(r, next_pow2_isize(index - r->start + 1));
+	}
+
+	u64 start = time_stamp_time_now();
+	while (!r->reached_eof && r->end - r->start < r->capacity) {
+		Token *token = &r->data[r->end & (r->capacity-1)];
+		tokenizer_get_token(&f->tokenizer, token);
+		if (token->kind == Token_Invalid) {
+			// NOTE: reported before the parser reaches the EOF which replaces the invalid token, so that it
+			// is this error rather than whatever the parser makes of the early EOF which is kept for its position
+			syntax_error(token->pos, "Failed to parse file: %.*s; invalid token found in file", LIT(r->file_name));
+			r->has_invalid_token = true;
+			token->kind = Token_EOF;
+		}
+		if (token->kind == Token_EOF) {
+			r->reached_eof = true;
+		}
+		if (r->end == 0) {
+			r->first_token = *token;
+		}
+		r->end += 1;
+	}
+	u64 end = time_stamp_time_now();
+	f->time_to_tokenize += cast(f64)(end-start)/cast(f64)time_stamp__freq();
+}
+
+// NOTE: returns nullptr past the end of the file; any previous pointer may be invalidated when
+// streaming and `index` has not been tokenized yet
+gb_internal Token *ast_file_token(AstFile *f, isize index) {
+	if (!ast_file_streams_tokens(f)) {
+		return index < f->tokens.count ? &f->tokens[index] : nullptr;
+	}
+	TokenRing *r = &f->token_ring;
+	if (index >= r->end) {
+		if (r->reached_eof) {
+			return nullptr;
+		}
+		token_ring_fill(f, index);
+		if (index >= r->end) {
+			return nullptr;
+		}
+	}
+	GB_ASSERT_MSG(index >= r->start, "token %td has already been dropped from the token ring", index);
+	return &r->data[index & (r->capacity-1)];
+}
+
+// NOTE: the number of tokens produced so far, which is all of them once the file has been parsed
+gb_internal isize ast_file_token_count(AstFile *f) {
+	if (f->token_ring.end > 0) {
+		return f->token_ring.end;
+	}
+	return f->tokens.count;
+}
+
+gb_internal Token ast_file_first_token(AstFile *f) {
+	if (f->token_ring.end > 0) {
+		return f->token_ring.first_token;
+	}
+	return f->tokens[0];
+}
+
 gb_internal bool next_token0(AstFile *f) {
-	if (f->curr_token_index+1 < f->tokens.count) {
-		f->curr_token = f->tokens[++f->curr_token_index];
+	if (Token *next = ast_file_token(f, f->curr_token_index+1)) {
+		f->curr_token = *next;
+		f->curr_token_index += 1;
 		return true;
 	}
 	syntax_error(f->curr_token, "Token is EOF");
@@ -1495,8 +1587,8 @@ gb_internal Token advance_token(AstFile *f) {
 
 
 gb_internal Token peek_token(AstFile *f) {
-	for (isize i = f->curr_token_index+1; i < f->tokens.count; i++) {
-		Token tok = f->tokens[i];
+	for (isize i = f->curr_token_index+1; Token *next = ast_file_token(f, i); i++) {
+		Token tok = *next;
 		if (tok.kind == Token_Comment) {
 			continue;
 		}
@@ -1507,8 +1599,8 @@ gb_internal Token peek_token(AstFile *f) {
 
 gb_internal Token peek_token_n(AstFile *f, isize n) {
 	Token found = {};
-	for (isize i = f->curr_token_index+1; i < f->tokens.count; i++) {
-		Token tok = f->tokens[i];
+	for (isize i = f->curr_token_index+1; Token *next = ast_file_token(f, i); i++) {
+		Token tok = *next;
 		if (tok.kind == Token_Comment) {
 			continue;
 		}
@@ -1653,7 +1745,7 @@ gb_internal Token expect_operator(AstFile *f) {
 	}
 	if (prev.kind == Token_Ellipsis) {
 		syntax_error(prev, "'..' for ranges are not allowed, did you mean '..<' or '..='?");
-		f->tokens[f->curr_token_index].flags |= TokenFlag_Replace;
+		ast_file_token(f, f->curr_token_index)->flags |= TokenFlag_Replace;
 	}
 	
 	advance_token(f);
@@ -1768,8 +1860,8 @@ gb_internal Token expect_closing(AstFile *f, TokenKind kind, String const &conte
 
 gb_internal void assign_removal_flag_to_semicolon(AstFile *f) {
 	// NOTE(bill): this is used for rewriting files to strip unneeded semicolons
-	Token *prev_token = &f->tokens[f->prev_token_index];
-	Token *curr_token = &f->tokens[f->curr_token_index];
+	Token *prev_token = ast_file_token(f, f->prev_token_index);
+	Token *curr_token = ast_file_token(f, f->curr_token_index);
 	GB_ASSERT(prev_token->kind == Token_Semicolon);
 	if (prev_token->string != ";") {
 		return;
@@ -2120,8 +2212,8 @@ gb_internal Ast *convert_stmt_to_expr(AstFile *f, Ast *statement, String const &
 
 	syntax_error(f->curr_token, "Expected '%.*s', found a simple statement.", LIT(kind));
 	Token end = f->curr_token;
-	if (f->tokens.count < f->curr_token_index) {
-		end = f->tokens[f->curr_token_index+1];
+	if (ast_file_token_count(f) < f->curr_token_index) {
+		end = *ast_file_token(f, f->curr_token_index+1);
 	}
 	return ast_bad_expr(f, f->curr_token, end);
 }
@@ -4685,10 +4777,11 @@ if_else_chain:;
 			expect_token(f, Token_do);
 			else_stmt = parse_do_body(f, else_token, "'else'");
 			break;
-		default:
+		default: {
 			syntax_error(f->curr_token, "Expected if statement block statement");
-			else_stmt = ast_bad_stmt(f, f->curr_token, f->tokens[f->curr_token_index+1]);
-			break;
+			Token *next = ast_file_token(f, f->curr_token_index+1);
+			else_stmt = ast_bad_stmt(f, f->curr_token, next ? *next : f->curr_token);
+		} break;
 		}
 	}
 
@@ -4743,10 +4836,11 @@ gb_internal Ast *parse_when_stmt(AstFile *f) {
 			expect_token(f, Token_do);
 			else_stmt = parse_do_body(f, else_token, "'else'");
 		} break;
-		default:
+		default: {
 			syntax_error(f->curr_token, "Expected when statement block statement");
-			else_stmt = ast_bad_stmt(f, f->curr_token, f->tokens[f->curr_token_index+1]);
-			break;
+			Token *next = ast_file_token(f, f->curr_token_index+1);
+			else_stmt = ast_bad_stmt(f, f->curr_token, next ? *next : f->curr_token);
+		} break;
 		}
 	}
 	f->in_when_statement = was_in_when_statement;
@@ -5545,13 +5639,29 @@ gb_internal Array<Ast *> parse_stmt_list(AstFile *f) {
 }
 
 
-gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, TokenPos *err_pos) {
+gb_internal void init_ast_file_path(AstFile *f, String const &fullpath) {
 	GB_ASSERT(f != nullptr);
 	f->fullpath  = string_trim_whitespace(fullpath); // Just in case
 	f->filename  = remove_directory_from_path(f->fullpath);
 	f->directory = directory_from_path(f->fullpath);
 	set_file_path_string(f->id, f->fullpath);
 	thread_safe_set_ast_file_from_id(f->id, f);
+}
+
+gb_internal void init_ast_file_cursor(AstFile *f) {
+	f->prev_token_index = 0;
+	f->curr_token_index = 0;
+	f->prev_token = *ast_file_token(f, f->prev_token_index);
+	f->curr_token = *ast_file_token(f, f->curr_token_index);
+
+	array_init(&f->comments, ast_allocator(f), 0, 0);
+	array_init(&f->imports,  ast_allocator(f), 0, 0);
+
+	f->curr_proc = nullptr;
+}
+
+gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, TokenPos *err_pos) {
+	init_ast_file_path(f, fullpath);
 	if (!string_ends_with(f->fullpath, str_lit(".odin"))) {
 		return ParseFile_WrongExtension;
 	}
@@ -5577,6 +5687,18 @@ gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, Tok
 
 	isize file_size = f->tokenizer.end - f->tokenizer.start;
 
+	// NOTE: very large files are tokenized as they are parsed, holding only a window of their tokens;
+	// rewriting a file needs all of them though
+	bool stream_tokens = build_context.internal_stream_tokens || file_size >= STREAM_TOKENS_MIN_FILE_SIZE;
+	if (stream_tokens && err != TokenizerInit_Empty && build_context.command_kind != Command_strip_semicolon) {
+		f->token_ring.data     = gb_alloc_array(heap_allocator(), Token, TOKEN_RING_INITIAL_CAPACITY);
+		f->token_ring.capacity = TOKEN_RING_INITIAL_CAPACITY;
+		memory_tag_add(MemoryTag_Tokens, f->token_ring.capacity*gb_size_of(Token));
+		token_ring_fill(f, 0);
+		init_ast_file_cursor(f);
+		return ParseFile_None;
+	}
+
 	// NOTE(bill): Determine allocation size required for tokens
 	isize token_cap = file_size/3ll;
 	isize pow2_cap = gb_max(cast(isize)prev_pow2(cast(i64)token_cap)/2, 16);
@@ -5612,22 +5734,17 @@ gb_internal ParseFileError init_ast_file(AstFile *f, String const &fullpath, Tok
 
 	u64 end = time_stamp_time_now();
 	f->time_to_tokenize = cast(f64)(end-start)/cast(f64)time_stamp__freq();
+	memory_tag_add(MemoryTag_Tokens, f->tokens.capacity*gb_size_of(Token));
 
-	f->prev_token_index = 0;
-	f->curr_token_index = 0;
-	f->prev_token = f->tokens[f->prev_token_index];
-	f->curr_token = f->tokens[f->curr_token_index];
-
-	array_init(&f->comments, ast_allocator(f), 0, 0);
-	array_init(&f->imports,  ast_allocator(f), 0, 0);
-
-	f->curr_proc = nullptr;
-
+	init_ast_file_cursor(f);
 	return ParseFile_None;
 }
 
 gb_internal void destroy_ast_file(AstFile *f) {
 	GB_ASSERT(f != nullptr);
+	if (ast_file_streams_tokens(f)) {
+		token_ring_destroy(&f->token_ring);
+	}
 	array_free(&f->tokens);
 	array_free(&f->comments);
 	array_free(&f->imports);
@@ -5755,7 +5872,6 @@ gb_internal AstPackage *try_add_import_path(Parser *p, String path, String const
 		FileInfo fi = {};
 		fi.name = filename_from_path(path);
 		fi.fullpath = path;
-		fi.size = get_file_size(path);
 		fi.is_dir = false;
 
 		array_reserve(&pkg->files, 1);
@@ -6183,10 +6299,18 @@ gb_internal String build_tag_get_token(String s, String *out) {
 	return s;
 }
 
-gb_internal bool parse_build_tag(Token token_for_pos, String s) {
+// NOTE: if `is_valid` is set, malformed tags are flagged through it rather than reported
+#define BUILD_TAG_ERROR(...) do { \
+	if (is_valid) { *is_valid = false; } else { syntax_error(token_for_pos, __VA_ARGS__); } \
+} while (0)
+
+gb_internal bool parse_build_tag(Token token_for_pos, String s, bool *is_valid=nullptr) {
 	String const prefix = str_lit("build");
 	GB_ASSERT(string_starts_with(s, prefix));
 	s = string_trim_whitespace(substring(s, prefix.len, s.len));
+	if (is_valid) {
+		*is_valid = true;
+	}
 
 	if (s.len == 0) {
 		return true;
@@ -6211,7 +6335,7 @@ gb_internal bool parse_build_tag(Token token_for_pos, String s) {
 				is_notted = true;
 				p = substring(p, 1, p.len);
 				if (p.len == 0) {
-					syntax_error(token_for_pos, "Expected a build platform after '!'");
+					BUILD_TAG_ERROR("Expected a build platform after '!'");
 					break;
 				}
 			}
@@ -6234,7 +6358,7 @@ gb_internal bool parse_build_tag(Token token_for_pos, String s) {
 			// Catches 'windows linux', which is an impossible combination.
 			// Also catches usage of more than two things within a comma separated group.
 			if (num_tokens > 2 || (this_kind_os_seen && os != TargetOs_Invalid) || (this_kind_arch_seen && arch != TargetArch_Invalid)) {
-				syntax_error(token_for_pos, "Invalid build tag: Missing ',' before '%.*s'. Format: '#+build linux, windows amd64, darwin'", LIT(p));
+				BUILD_TAG_ERROR("Invalid build tag: Missing ',' before '%.*s'. Format: '#+build linux, windows amd64, darwin'", LIT(p));
 				break;
 			}
 
@@ -6242,7 +6366,7 @@ gb_internal bool parse_build_tag(Token token_for_pos, String s) {
 			if (subtarget == Subtarget_Invalid) {
 				// Special case for pseudo subtarget
 				if (!str_eq_ignore_case(subtarget_str, "ios")) {
-					syntax_error(token_for_pos, "Invalid subtarget '%.*s'.", LIT(subtarget_str));
+					BUILD_TAG_ERROR("Invalid subtarget '%.*s'.", LIT(subtarget_str));
 					break;
 				}
 
@@ -6278,7 +6402,7 @@ gb_internal bool parse_build_tag(Token token_for_pos, String s) {
 				}
 			}
 			if (os == TargetOs_Invalid && arch == TargetArch_Invalid) {
-				syntax_error(token_for_pos, "Invalid build tag platform: %.*s", LIT(p));
+				BUILD_TAG_ERROR("Invalid build tag platform: %.*s", LIT(p));
 				break;
 			}
 		} while (s.len > 0);
@@ -6289,6 +6413,8 @@ gb_internal bool parse_build_tag(Token token_for_pos, String s) {
 	return any_correct;
 }
 
+#undef BUILD_TAG_ERROR
+
 gb_internal String vet_tag_get_token(String s, String *out) {
 	s = string_trim_whitespace(s);
 	isize n = 0;
@@ -6569,10 +6695,10 @@ gb_internal bool parse_file_tag(const String &lc, const Token &tok, AstFile *f)
 }
 
 gb_internal bool parse_file(Parser *p, AstFile *f) {
-	if (f->tokens.count == 0) {
+	if (ast_file_token_count(f) == 0) {
 		return true;
 	}
-	if (f->tokens.count > 0 && f->tokens[0].kind == Token_EOF) {
+	if (ast_file_token_count(f) > 0 && ast_file_first_token(f).kind == Token_EOF) {
 		return true;
 	}
 
@@ -6720,6 +6846,147 @@ gb_internal bool parse_file(Parser *p, AstFile *f) {
 }
 
 
+enum FileHeaderTags {
+	FileHeaderTags_Unknown, // leave the decision to `parse_file`
+	FileHeaderTags_Included,
+	FileHeaderTags_Excluded,
+};
+
+gb_internal void check_imported_file_name(AstFile *file, TokenPos pos) {
+	String name = file->fullpath;
+	name = remove_directory_from_path(name);
+	name = remove_extension_from_path(name);
+
+	if (string_starts_with(name, str_lit("_"))) {
+		syntax_error(pos, "Files cannot start with '_', got '%.*s'", LIT(file->fullpath));
+	}
+}
+
+// NOTE: Reads only the leading block of a file and evaluates its `#+build` and `#+ignore` tags, so
+// that files for other targets can be skipped before being read in full and tokenized. Anything
+// which `parse_file` would report on (deprecated `//+` tags, malformed or unknown tags, a missing
+// or invalid package clause) is left to it
+gb_internal FileHeaderTags scan_file_header_tags(String const &fullpath) {
+	enum {FILE_HEADER_SCAN_SIZE = 4096};
+
+	u8 buffer[FILE_HEADER_SCAN_SIZE];
+	isize buffer_len = 0;
+	{
+		TEMPORARY_ALLOCATOR_GUARD();
+		gbFile f = {};
+		if (gb_file_open(&f, alloc_cstring(temporary_allocator(), fullpath)) != gbFileError_None) {
+			return FileHeaderTags_Unknown;
+		}
+		bool ok = gb_file_read_at_check(&f, buffer, gb_size_of(buffer), 0, &buffer_len);
+		gb_file_close(&f);
+		if (!ok) {
+			return FileHeaderTags_Unknown;
+		}
+	}
+
+	String s = make_string(buffer, buffer_len);
+	if (string_starts_with(s, str_lit("\xef\xbb\xbf"))) {
+		s = substring(s, 3, s.len);
+	}
+
+	bool is_excluded = false;
+	while (s.len > 0) {
+		u8 c = s[0];
+		if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+			s = substring(s, 1, s.len);
+			continue;
+		}
+		if (string_starts_with(s, str_lit("//")) || string_starts_with(s, str_lit("#!"))) {
+			isize end = string_index_byte(s, '\n');
+			if (end < 0) {
+				return FileHeaderTags_Unknown;
+			}
+			if (string_starts_with(string_trim_whitespace(substring(s, 2, end)), str_lit("+"))) {
+				return FileHeaderTags_Unknown;
+			}
+			s = substring(s, end, s.len);
+			continue;
+		}
+		if (string_starts_with(s, str_lit("/*"))) {
+			isize depth = 0;
+			isize i = 0;
+			for (; i+1 < s.len; i++) {
+				if (s[i] == '/' && s[i+1] == '*') {
+					depth += 1;
+					i += 1;
+				} else if (s[i] == '*' && s[i+1] == '/') {
+					depth -= 1;
+					i += 1;
+					if (depth == 0) {
+						break;
+					}
+				}
+			}
+			if (depth != 0) {
+				return FileHeaderTags_Unknown;
+			}
+			s = substring(s, i+1, s.len);
+			continue;
+		}
+		if (string_starts_with(s, str_lit("#+"))) {
+			// NOTE: matches the tokenizer, a tag ends at a new line or the start of a comment
+			isize end = 2;
+			while (end < s.len && s[end] != '\n' && s[end] != '/') {
+				end += 1;
+			}
+			if (end == s.len) {
+				return FileHeaderTags_Unknown;
+			}
+			String tag = string_trim_whitespace(substring(s, 2, end));
+			s = substring(s, end, s.len);
+			if (is_excluded) {
+				// NOTE: `parse_file` stops at the first excluding tag
+				continue;
+			}
+
+			if (string_starts_with(tag, str_lit("build-project-name"))) {
+				return FileHeaderTags_Unknown;
+			} else if (string_starts_with(tag, str_lit("build"))) {
+				bool is_valid = true;
+				bool is_included = parse_build_tag({}, tag, &is_valid);
+				if (!is_valid) {
+					return FileHeaderTags_Unknown;
+				}
+				is_excluded = !is_included;
+			} else if (string_starts_with(tag, str_lit("ignore"))) {
+				is_excluded = true;
+			} else if (string_starts_with(tag, str_lit("private")) || tag == "lazy" || tag == "no-instrumentation") {
+				// NOTE: these cannot report errors
+			} else {
+				return FileHeaderTags_Unknown;
+			}
+			continue;
+		}
+
+		String const keyword = str_lit("package");
+		if (!string_starts_with(s, keyword) || s.len == keyword.len || !gb_char_is_space(s[keyword.len])) {
+			return FileHeaderTags_Unknown;
+		}
+		s = string_trim_starts_with(s, keyword);
+		while (s.len > 0 && gb_char_is_space(s[0]) && s[0] != '\n') {
+			s = substring(s, 1, s.len);
+		}
+		isize name_len = 0;
+		while (name_len < s.len && (gb_char_is_alphanumeric(s[name_len]) || s[name_len] == '_')) {
+			name_len += 1;
+		}
+		if (name_len == s.len || !(gb_char_is_space(s[name_len]) || s[name_len] == ';' || s[name_len] == '/')) {
+			return FileHeaderTags_Unknown;
+		}
+		String name = substring(s, 0, name_len);
+		if (name.len == 0 || name == "_" || name == "runtime" || is_package_name_reserved(name) || gb_char_is_digit(name[0])) {
+			return FileHeaderTags_Unknown;
+		}
+		return is_excluded ? FileHeaderTags_Excluded : FileHeaderTags_Included;
+	}
+	return FileHeaderTags_Unknown;
+}
+
 gb_internal ParseFileError process_imported_file(Parser *p, ImportedFile imported_file) {
 	AstPackage *pkg = imported_file.pkg;
 	FileInfo    fi  = imported_file.fi;
@@ -6728,7 +6995,16 @@ gb_internal ParseFileError process_imported_file(Parser *p, ImportedFile importe
 	AstFile *file = gb_alloc_item(permanent_allocator(), AstFile);
 	file->pkg = pkg;
 	file->id = cast(i32)(imported_file.index+1);
+
+	if (fi.fullpath != p->init_fullpath && scan_file_header_tags(fi.fullpath) == FileHeaderTags_Excluded) {
+		init_ast_file_path(file, fi.fullpath);
+		check_imported_file_name(file, pos);
+		p->total_excluded_file_count.fetch_add(1);
+		return ParseFile_None;
+	}
+
 	TokenPos err_pos = {0};
+	file->token_ring.file_name = fi.name;
 	ParseFileError err = init_ast_file(file, fi.fullpath, &err_pos);
 	err_pos.file_id = file->id;
 	file->last_error = err;
@@ -6768,23 +7044,25 @@ gb_internal ParseFileError process_imported_file(Parser *p, ImportedFile importe
 		}
 	}
 
-	{
-		String name = file->fullpath;
-		name = remove_directory_from_path(name);
-		name = remove_extension_from_path(name);
-
-		if (string_starts_with(name, str_lit("_"))) {
-			syntax_error(pos, "Files cannot start with '_', got '%.*s'", LIT(file->fullpath));
-		}
-	}
+	check_imported_file_name(file, pos);
 
 	if (build_context.command_kind == Command_test) {
 		String name = file->fullpath;
 		name = remove_extension_from_path(name);
 	}
 
+	bool parsed = parse_file(p, file);
+	if (ast_file_streams_tokens(file)) {
+		// NOTE: the tokens are no longer needed once the file has been parsed
+		TokenRing *r = &file->token_ring;
+		bool has_invalid_token = r->has_invalid_token;
+		token_ring_destroy(r);
+		if (has_invalid_token) {
+			return ParseFile_InvalidToken;
+		}
+	}
 
-	if (parse_file(p, file)) {
+	if (parsed) {
 		MUTEX_GUARD_BLOCK(&pkg->files_mutex) {
 			array_add(&pkg->files, file);
 		}
@@ -6793,7 +7071,7 @@ gb_internal ParseFileError process_imported_file(Parser *p, ImportedFile importe
 		if (pkg->name.len == 0) {
 			pkg->name = file->package_name;
 		} else if (pkg->name != file->package_name) {
-			if (file->tokens.count > 0 && file->tokens[0].kind != Token_EOF) {
+			if (ast_file_token_count(file) > 0 && ast_file_first_token(file).kind != Token_EOF) {
 				Token tok = file->package_token;
 				tok.pos.file_id = file->id;
 				tok.pos.line = gb_max(tok.pos.line, 1);
@@ -6804,7 +7082,7 @@ gb_internal ParseFileError process_imported_file(Parser *p, ImportedFile importe
 		mutex_unlock(&pkg->name_mutex);
 
 		p->total_line_count.fetch_add(file->tokenizer.line_count);
-		p->total_token_count.fetch_add(file->tokens.count);
+		p->total_token_count.fetch_add(ast_file_token_count(file));
 	}
 
 	return ParseFile_None;
@@ -86,6 +86,19 @@ enum AstDelayQueueKind {
 	AstDelayQueue_COUNT,
 };
 
+// NOTE: A window over a file's tokens which the tokenizer fills as the parser advances, used instead
+// of `AstFile::tokens` for very large files. Tokens before `prev_token_index` are dropped.
+struct TokenRing {
+	Token *  data;
+	isize    capacity; // power of two
+	isize    start;    // index of the oldest token still held
+	isize    end;      // one past the index of the newest token
+	bool     reached_eof;
+	bool     has_invalid_token;
+	Token    first_token;
+	String   file_name; // as named in an invalid token error
+};
+
 struct AstFile {
 	i32          id;
 	u32          flags;
@@ -99,7 +112,8 @@ struct AstFile {
 	String       directory;
 
 	Tokenizer    tokenizer;
-	Array<Token> tokens;
+	Array<Token> tokens;     // empty when `token_ring` is in use
+	TokenRing    token_ring;
 	isize        curr_token_index;
 	isize        prev_token_index;
 	Token        curr_token;
@@ -214,6 +228,7 @@ struct Parser {
 	std::atomic<isize>     file_to_process_count;
 	std::atomic<isize>     total_token_count;
 	std::atomic<isize>     total_line_count;
+	std::atomic<isize>     total_excluded_file_count; // excluded by their header tags before tokenizing
 
 	std::atomic<isize>     total_seen_load_directive_count;
 
@@ -279,7 +279,6 @@ gb_internal bool path_is_directory(Path path) {
 struct FileInfo {
 	String name;
 	String fullpath;
-	i64    size;
 	bool   is_dir;
 };
 
@@ -296,22 +295,8 @@ enum ReadDirectoryError {
 	ReadDirectory_COUNT,
 };
 
-gb_internal i64 get_file_size(String path) {
-	char *c_str = alloc_cstring(heap_allocator(), path);
-	defer (gb_free(heap_allocator(), c_str));
-
-	gbFile f = {};
-	gbFileError err = gb_file_open(&f, c_str);
-	defer (gb_file_close(&f));
-	if (err != gbFileError_None) {
-		return -1;
-	}
-	return gb_file_size(&f);
-}
-
-
 #if defined(GB_SYSTEM_WINDOWS)
-gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi) {
+gb_internal ReadDirectoryError read_directory_internal(String path, Array<FileInfo> *fi) {
 	GB_ASSERT(fi != nullptr);
 
 
@@ -370,8 +355,6 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 
 	do {
 		wchar_t *filename_w = file_data.cFileName;
-		u64 size = cast(u64)file_data.nFileSizeLow;
-		size |= (cast(u64)file_data.nFileSizeHigh) << 32;
 		String name = string16_to_string(a, make_string16_c(filename_w));
 		if (name == "." || name == "..") {
 			gb_free(a, name.text);
@@ -389,7 +372,6 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 		FileInfo info = {};
 		info.name = name;
 		info.fullpath = path_to_full_path(a, filepath);
-		info.size = cast(i64)size;
 		info.is_dir = (file_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
 		array_add(fi, info);
 	} while (FindNextFileW(find_file, &file_data));
@@ -403,18 +385,27 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 #elif defined(GB_SYSTEM_LINUX) || defined(GB_SYSTEM_OSX) || defined(GB_SYSTEM_FREEBSD) || defined(GB_SYSTEM_OPENBSD) || defined(GB_SYSTEM_NETBSD) || defined(GB_SYSTEM_HAIKU)
 
 #include <dirent.h>
+#include <fcntl.h>
 
-gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi) {
+// NOTE: The directory is opened once and resolved to its full path once; entries are classified by
+// `d_type` where the file system provides it, falling back to `fstatat` relative to the directory
+// rather than a `stat` and `realpath` per entry
+gb_internal ReadDirectoryError read_directory_internal(String path, Array<FileInfo> *fi) {
 	GB_ASSERT(fi != nullptr);
 
-	gbAllocator a = heap_allocator();
+	gbAllocator a = permanent_allocator();
 
-	char *c_path = alloc_cstring(a, path);
-	defer (gb_free(a, c_path));
+	char *c_path = alloc_cstring(heap_allocator(), path);
+	defer (gb_free(heap_allocator(), c_path));
 
-	DIR *dir = opendir(c_path);
+	int dir_fd = open(c_path, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+	DIR *dir = dir_fd >= 0 ? fdopendir(dir_fd) : nullptr;
 	if (!dir) {
-		switch (errno) {
+		int err = errno;
+		if (dir_fd >= 0) {
+			close(dir_fd);
+		}
+		switch (err) {
 		case ENOENT:
 			return ReadDirectory_NotExists;
 		case EACCES:
@@ -429,8 +420,14 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 		}
 		GB_PANIC("unreachable");
 	}
+	defer (closedir(dir));
 
-	array_init(fi, a, 0, 100);
+	String dir_path = path_to_full_path(a, path);
+	while (dir_path.len > 1 && dir_path[dir_path.len-1] == '/') {
+		dir_path.len -= 1;
+	}
+
+	array_init(fi, heap_allocator(), 0, 100);
 
 	for (;;) {
 		struct dirent *entry = readdir(dir);
@@ -443,29 +440,26 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 			continue;
 		}
 
-		String filepath = {};
-		filepath.len = path.len+1+name.len;
-		filepath.text = gb_alloc_array(a, u8, filepath.len+1);
-		defer (gb_free(a, filepath.text));
-		gb_memmove(filepath.text, path.text, path.len);
-		gb_memmove(filepath.text+path.len, "/", 1);
-		gb_memmove(filepath.text+path.len+1, name.text, name.len);
-		filepath.text[filepath.len] = 0;
-
-
-		struct stat dir_stat = {};
-
-		if (stat((char *)filepath.text, &dir_stat)) {
-			continue;
+		bool is_dir = false;
+		bool needs_stat = true;
+	#if defined(DT_DIR)
+		switch (entry->d_type) {
+		case DT_DIR: is_dir = true;  needs_stat = false; break;
+		case DT_REG: is_dir = false; needs_stat = false; break;
+		}
+	#endif
+		if (needs_stat) {
+			struct stat entry_stat = {};
+			if (fstatat(dir_fd, entry->d_name, &entry_stat, 0)) {
+				continue;
+			}
+			is_dir = S_ISDIR(entry_stat.st_mode);
 		}
-
-		i64 size = dir_stat.st_size;
 
 		FileInfo info = {};
 		info.name = copy_string(a, name);
-		info.fullpath = path_to_full_path(a, filepath);
-		info.size = size;
-		info.is_dir = S_ISDIR(dir_stat.st_mode);
+		info.fullpath = concatenate3_strings(a, dir_path, str_lit("/"), name);
+		info.is_dir = is_dir;
 		array_add(fi, info);
 	}
 
@@ -481,6 +475,63 @@ gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi)
 #error Implement read_directory
 #endif
 
+// NOTE: Directory listings and file modification times are cached for the whole compiler
+// invocation, as nothing the compiler reads is expected to change underneath it
+struct DirectoryCacheEntry {
+	ReadDirectoryError error;
+	Slice<FileInfo>    files;
+};
+
+gb_global BlockingMutex                  g_path_cache_mutex;
+gb_global StringMap<DirectoryCacheEntry> g_directory_cache;
+gb_global StringMap<gbFileTime>          g_file_time_cache;
+
+// NOTE: `fi` receives a copy of the cached listing which the caller frees; the strings are shared
+gb_internal ReadDirectoryError read_directory(String path, Array<FileInfo> *fi) {
+	GB_ASSERT(fi != nullptr);
+	DirectoryCacheEntry entry = {};
+	bool found = false;
+
+	mutex_lock(&g_path_cache_mutex);
+	if (DirectoryCacheEntry *cached = string_map_get(&g_directory_cache, path)) {
+		entry = *cached;
+		found = true;
+	}
+	mutex_unlock(&g_path_cache_mutex);
+
+	if (!found) {
+		Array<FileInfo> list = {};
+		entry.error = read_directory_internal(path, &list);
+		entry.files = slice_clone_from_array(permanent_allocator(), list);
+		array_free(&list);
+
+		mutex_lock(&g_path_cache_mutex);
+		string_map_set(&g_directory_cache, copy_string(permanent_allocator(), path), entry);
+		mutex_unlock(&g_path_cache_mutex);
+	}
+
+	array_init(fi, heap_allocator(), entry.files.count);
+	gb_memmove_array(fi->data, entry.files.data, entry.files.count);
+	return entry.error;
+}
+
+gb_internal gbFileTime file_last_write_time_cached(String path) {
+	mutex_lock(&g_path_cache_mutex);
+	gbFileTime *cached = string_map_get(&g_file_time_cache, path);
+	gbFileTime time = cached ? *cached : 0;
+	mutex_unlock(&g_path_cache_mutex);
+	if (cached) {
+		return time;
+	}
+
+	time = gb_file_last_write_time(alloc_cstring(temporary_allocator(), path));
+
+	mutex_lock(&g_path_cache_mutex);
+	string_map_set(&g_file_time_cache, copy_string(permanent_allocator(), path), time);
+	mutex_unlock(&g_path_cache_mutex);
+	return time;
+}
+
 #if !defined(GB_SYSTEM_WINDOWS)
 gb_internal bool write_directory(String path) {
 	char const *pathname = (char *) path.text;
@@ -72,7 +72,7 @@ template <typename K, typename V> gb_internal void  multi_map_remove    (PtrMap<
 template <typename K, typename V> gb_internal void  multi_map_remove_all(PtrMap<K, V> *h, K key);
 
 gb_internal gbAllocator map_allocator(void) {
-	return heap_allocator();
+	return tagged_heap_allocator(MemoryTag_Map);
 }
 
 template <typename K, typename V>
@@ -17,7 +17,7 @@ template <typename T> gb_internal void ptr_set_remove (PtrSet<T> *s, T ptr);
 template <typename T> gb_internal void ptr_set_clear  (PtrSet<T> *s);
 
 gb_internal gbAllocator ptr_set_allocator(void) {
-	return heap_allocator();
+	return tagged_heap_allocator(MemoryTag_Map);
 }
 
 template <typename T>
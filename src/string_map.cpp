@@ -66,7 +66,7 @@ template <typename T> gb_internal void string_map_grow    (StringMap<T> *h);
 template <typename T> gb_internal void string_map_reserve (StringMap<T> *h, usize new_count);
 
 gb_internal gbAllocator string_map_allocator(void) {
-	return heap_allocator();
+	return tagged_heap_allocator(MemoryTag_Map);
 }
 
 template <typename T>
@@ -350,7 +350,7 @@ template <typename T> gb_internal void string_map_grow    (StringMap<T> *h);
 template <typename T> gb_internal void string_map_reserve (StringMap<T> *h, usize new_count);
 
 gb_internal gbAllocator string_map_allocator(void) {
-	return heap_allocator();
+	return tagged_heap_allocator(MemoryTag_Map);
 }
 
 template <typename T>
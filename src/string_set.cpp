@@ -28,7 +28,7 @@ gb_internal void string_set_grow   (StringSet *s);
 gb_internal void string_set_rehash (StringSet *s, isize new_count);
 
 gb_internal gbAllocator string_set_allocator(void) {
-	return heap_allocator();
+	return tagged_heap_allocator(MemoryTag_Map);
 }
 
 gb_internal gb_inline void string_set_init(StringSet *s, isize capacity) {
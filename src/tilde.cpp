@@ -362,7 +362,7 @@ gb_internal bool cg_global_variables_create(cgModule *m, Array<cgGlobalVariable>
 
 		if (is_foreign) {
 			linkage = TB_LINKAGE_PUBLIC;
-			// lb_add_foreign_library_path(m, e->Variable.foreign_library);
+			// lb_add_foreign_library_path(m, entity_cold(e)->foreign_library);
 		} else if (is_export) {
 			linkage = TB_LINKAGE_PUBLIC;
 		}
@@ -374,12 +374,12 @@ gb_internal bool cg_global_variables_create(cgModule *m, Array<cgGlobalVariable>
 
 		TB_ModuleSectionHandle section = tb_module_get_data(m->mod);
 
-		if (e->Variable.thread_local_model != "") {
+		if (entity_cold(e)->thread_local_model != "") {
 			section = tb_module_get_tls(m->mod);
 		}
-		if (e->Variable.link_section.len > 0) {
+		if (entity_cold(e)->link_section.len > 0) {
 			// TODO(bill): custom module sections
-			// LLVMSetSection(g.value, alloc_cstring(permanent_allocator(), e->Variable.link_section));
+			// LLVMSetSection(g.value, alloc_cstring(permanent_allocator(), entity_cold(e)->link_section));
 		}
 
 
@@ -610,9 +610,9 @@ gb_internal String cg_get_entity_name(cgModule *m, Entity *e) {
 	if (e->kind == Entity_Variable) {
 		bool is_foreign = e->Variable.is_foreign;
 		bool is_export  = e->Variable.is_export;
-		no_name_mangle = e->Variable.link_name.len > 0 || is_foreign || is_export;
-		if (e->Variable.link_name.len > 0) {
-			return e->Variable.link_name;
+		no_name_mangle = entity_cold(e)->link_name.len > 0 || is_foreign || is_export;
+		if (entity_cold(e)->link_name.len > 0) {
+			return entity_cold(e)->link_name;
 		}
 	} else if (e->kind == Entity_Procedure && e->Procedure.link_name.len > 0) {
 		return e->Procedure.link_name;
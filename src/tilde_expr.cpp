@@ -104,8 +104,8 @@ gb_internal cgValue cg_get_using_variable(cgProcedure *p, Entity *e) {
 	} else if (pv != nullptr) {
 		v = *pv;
 	} else {
-		GB_ASSERT_MSG(e->using_expr != nullptr, "%.*s %.*s", LIT(e->token.string), LIT(name));
-		v = cg_build_addr_ptr(p, e->using_expr);
+		GB_ASSERT_MSG(entity_cold(e)->using_expr != nullptr, "%.*s %.*s", LIT(e->token.string), LIT(name));
+		v = cg_build_addr_ptr(p, entity_cold(e)->using_expr);
 	}
 	GB_ASSERT(v.node != nullptr);
 	GB_ASSERT_MSG(parent->type == type_deref(v.type), "%s %s", type_to_string(parent->type), type_to_string(v.type));
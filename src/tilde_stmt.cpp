@@ -2491,9 +2491,9 @@ gb_internal void cg_build_mutable_value_decl(cgProcedure *p, Ast *node) {
 			TB_Global *global = tb_global_create(m->mod, mangled_name.len, cast(char const *)mangled_name.text, debug_type, TB_LINKAGE_PRIVATE);
 
 			TB_ModuleSectionHandle section = tb_module_get_data(m->mod);
-			if (e->Variable.thread_local_model != "") {
+			if (entity_cold(e)->thread_local_model != "") {
 				section = tb_module_get_tls(m->mod);
-				String model = e->Variable.thread_local_model;
+				String model = entity_cold(e)->thread_local_model;
 				if (model == "default") {
 					// TODO(bill): Thread Local Storage models
 				} else if (model == "localdynamic") {
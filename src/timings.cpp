@@ -2,6 +2,10 @@ struct TimeStamp {
 	u64    start;
 	u64    finish;
 	String label;
+
+	// NOTE: only recorded when `global_memory_tags_enabled`
+	isize  memory_current[MemoryTag_COUNT]; // at the end of the section
+	isize  memory_peak[MemoryTag_COUNT];    // during the section
 };
 
 struct Timings {
@@ -122,14 +126,27 @@ gb_internal void timings_destroy(Timings *t) {
 	array_free(&t->sections);
 }
 
+gb_internal void time_stamp_record_memory(TimeStamp *ts) {
+	if (global_memory_tags_enabled) {
+		memory_tags_sample();
+		for (isize tag = 0; tag < MemoryTag_COUNT; tag++) {
+			ts->memory_current[tag] = global_memory_tags[tag].current.load(std::memory_order_relaxed);
+			ts->memory_peak[tag]    = global_memory_tags[tag].peak.load(std::memory_order_relaxed);
+		}
+	}
+}
+
 gb_internal void timings__stop_current_section(Timings *t) {
 	if (t->sections.count > 0) {
-		t->sections[t->sections.count-1].finish = time_stamp_time_now();
+		TimeStamp *ts = &t->sections[t->sections.count-1];
+		ts->finish = time_stamp_time_now();
+		time_stamp_record_memory(ts);
 	}
 }
 
 gb_internal void timings_start_section(Timings *t, String const &label) {
 	timings__stop_current_section(t);
+	memory_tags_reset_peaks();
 	array_add(&t->sections, make_time_stamp(label));
 }
 
@@ -214,4 +231,23 @@ gb_internal void timings_print_all(Timings *t, TimingUnit unit = TimingUnit_Mill
 		          timing_unit_strings[unit],
 		          100.0*section_time/total_time);
 	}
+
+	if (global_memory_tags_enabled) {
+		f64 const MIB = 1024.0*1024.0;
+		isize const tag_width = 16;
+		gb_printf_err("\nMemory (current at the end of each section / peak during it)\n");
+		for (TimeStamp const &ts : t->sections) {
+			gb_printf_err("%.*s\n", LIT(ts.label));
+			for (isize tag = 0; tag < MemoryTag_COUNT; tag++) {
+				if (ts.memory_current[tag] == 0 && ts.memory_peak[tag] == 0) {
+					continue;
+				}
+				char const *name = memory_tag_names[tag];
+				gb_printf_err("    %s%.*s - % 10.3f MiB / % 10.3f MiB\n",
+				              name, cast(int)(tag_width-gb_strlen(name)), SPACES,
+				              cast(f64)ts.memory_current[tag]/MIB,
+				              cast(f64)ts.memory_peak[tag]/MIB);
+			}
+		}
+	}
 }
\ No newline at end of file
@@ -376,7 +376,7 @@ enum TypeInfoFlag : u32 {
 
 enum : int {
 	MATRIX_ELEMENT_COUNT_MIN = 1,
-	MATRIX_ELEMENT_COUNT_MAX = 16,
+	MATRIX_ELEMENT_COUNT_MAX = 64,
 	MATRIX_ELEMENT_MAX_SIZE = MATRIX_ELEMENT_COUNT_MAX * (2 * 8), // complex128
 
 	SIMD_ELEMENT_COUNT_MIN = 1,
@@ -942,6 +942,7 @@ gb_internal Type *alloc_type(TypeKind kind) {
 	// gbAllocator a = heap_allocator();
 	gbAllocator a = permanent_allocator();
 	Type *t = gb_alloc_item(a, Type);
+	memory_tag_add(MemoryTag_Type, gb_size_of(Type));
 	gb_zero_item(t);
 	t->kind = kind;
 	t->cached_size  = -1;
@@ -959,19 +960,100 @@ gb_internal Type *alloc_type_generic(Scope *scope, i64 id, String name, Type *sp
 	return t;
 }
 
+// NOTE: Unnamed structural types which are fully determined by their element type and constant
+// parameters are hash-consed, so identical types share a single node and compare equal by pointer.
+// Types which are completed after construction (e.g. `[?]T`, polymorphic counts or elements) are
+// always allocated fresh.
+enum {
+	TYPE_INTERN_SHARD_BITS  = 6,
+	TYPE_INTERN_SHARD_COUNT = 1<<TYPE_INTERN_SHARD_BITS,
+};
+
+struct TypeInternShard {
+	BlockingMutex          mutex;
+	PtrMap<Type *, Type *> types; // NOTE: multi-map keyed on the element type
+};
+
+gb_global TypeInternShard g_type_intern_shards[TYPE_INTERN_SHARD_COUNT];
+
+gb_internal bool type_intern_can_key(Type *elem) {
+	return elem != nullptr && elem->kind != Type_Generic;
+}
+
+gb_internal bool type_intern_matches(Type *t, TypeKind kind, i64 a, i64 b, bool is_row_major) {
+	if (t->kind != kind) {
+		return false;
+	}
+	switch (kind) {
+	case Type_Array:
+		return t->Array.count == a;
+	case Type_Matrix:
+		return t->Matrix.row_count == a && t->Matrix.column_count == b && t->Matrix.is_row_major == is_row_major;
+	}
+	return true;
+}
+
+gb_internal Type *alloc_type_interned(TypeKind kind, Type *elem, i64 a=0, i64 b=0, bool is_row_major=false) {
+	GB_ASSERT(type_intern_can_key(elem));
+	// NOTE: use the high bits for the shard as the map itself probes with the low bits
+	u32 shard_index = ptr_map_hash_key(elem) >> (32-TYPE_INTERN_SHARD_BITS);
+	TypeInternShard *shard = &g_type_intern_shards[shard_index];
+
+	mutex_lock(&shard->mutex);
+	defer (mutex_unlock(&shard->mutex));
+
+	for (auto *e = multi_map_find_first(&shard->types, elem); e != nullptr; e = multi_map_find_next(&shard->types, e)) {
+		if (type_intern_matches(e->value, kind, a, b, is_row_major)) {
+			return e->value;
+		}
+	}
+
+	Type *t = alloc_type(kind);
+	switch (kind) {
+	case Type_Pointer:      t->Pointer.elem      = elem; break;
+	case Type_MultiPointer: t->MultiPointer.elem = elem; break;
+	case Type_SoaPointer:   t->SoaPointer.elem   = elem; break;
+	case Type_Slice:        t->Slice.elem        = elem; break;
+	case Type_DynamicArray: t->DynamicArray.elem = elem; break;
+	case Type_Array:
+		t->Array.elem  = elem;
+		t->Array.count = a;
+		break;
+	case Type_Matrix:
+		t->Matrix.elem         = elem;
+		t->Matrix.row_count    = a;
+		t->Matrix.column_count = b;
+		t->Matrix.is_row_major = is_row_major;
+		break;
+	default:
+		GB_PANIC("Unsupported interned type kind");
+	}
+	multi_map_insert(&shard->types, elem, t);
+	return t;
+}
+
 gb_internal Type *alloc_type_pointer(Type *elem) {
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_Pointer, elem);
+	}
 	Type *t = alloc_type(Type_Pointer);
 	t->Pointer.elem = elem;
 	return t;
 }
 
 gb_internal Type *alloc_type_multi_pointer(Type *elem) {
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_MultiPointer, elem);
+	}
 	Type *t = alloc_type(Type_MultiPointer);
 	t->MultiPointer.elem = elem;
 	return t;
 }
 
 gb_internal Type *alloc_type_soa_pointer(Type *elem) {
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_SoaPointer, elem);
+	}
 	Type *t = alloc_type(Type_SoaPointer);
 	t->SoaPointer.elem = elem;
 	return t;
@@ -1007,6 +1089,9 @@ gb_internal Type *alloc_type_array(Type *elem, i64 count, Type *generic_count =
 		t->Array.generic_count = generic_count;
 		return t;
 	}
+	if (count >= 0 && type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_Array, elem, count);
+	}
 	Type *t = alloc_type(Type_Array);
 	t->Array.elem = elem;
 	t->Array.count = count;
@@ -1024,6 +1109,9 @@ gb_internal Type *alloc_type_matrix(Type *elem, i64 row_count, i64 column_count,
 		t->Matrix.is_row_major         = is_row_major;
 		return t;
 	}
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_Matrix, elem, row_count, column_count, is_row_major);
+	}
 	Type *t = alloc_type(Type_Matrix);
 	t->Matrix.elem = elem;
 	t->Matrix.row_count = row_count;
@@ -1053,12 +1141,18 @@ gb_internal Type *alloc_type_enumerated_array(Type *elem, Type *index, ExactValu
 
 
 gb_internal Type *alloc_type_slice(Type *elem) {
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_Slice, elem);
+	}
 	Type *t = alloc_type(Type_Slice);
 	t->Slice.elem = elem;
 	return t;
 }
 
 gb_internal Type *alloc_type_dynamic_array(Type *elem) {
+	if (type_intern_can_key(elem)) {
+		return alloc_type_interned(Type_DynamicArray, elem);
+	}
 	Type *t = alloc_type(Type_DynamicArray);
 	t->DynamicArray.elem = elem;
 	return t;
@@ -3772,6 +3866,22 @@ gb_internal i64 type_size_of_struct_pretend_is_packed(Type *ot) {
 }
 
 
+// NOTE: Only the base record types laid out by `type_cache_layout` are read through a named type, as
+// the base of a named type may not be known yet when it is first asked for
+gb_internal Type *type_record_with_cached_layout(Type *t) {
+	if (t->kind != Type_Named) {
+		return nullptr;
+	}
+	Type *bt = base_type(t);
+	if (bt == nullptr || (bt->kind != Type_Struct && bt->kind != Type_Union)) {
+		return nullptr;
+	}
+	if (bt->cached_size < 0 || bt->cached_align <= 0) {
+		return nullptr;
+	}
+	return bt;
+}
+
 gb_internal i64 type_size_of(Type *t) {
 	if (t == nullptr) {
 		return 0;
@@ -3799,6 +3909,8 @@ gb_internal i64 type_size_of(Type *t) {
 		return size;
 	} else if (t->kind != Type_Named && t->cached_size >= 0) {
 		return t->cached_size.load();
+	} else if (Type *bt = type_record_with_cached_layout(t)) {
+		return bt->cached_size.load();
 	} else {
 		TypePath path{};
 		type_path_init(&path);
@@ -3819,6 +3931,9 @@ gb_internal i64 type_align_of(Type *t) {
 	if (t->kind != Type_Named && t->cached_align > 0) {
 		return t->cached_align.load();
 	}
+	if (Type *bt = type_record_with_cached_layout(t)) {
+		return bt->cached_align.load();
+	}
 
 	TypePath path{};
 	type_path_init(&path);
@@ -3909,6 +4024,9 @@ gb_internal i64 type_align_of_internal(Type *t, TypePath *path) {
 		return type_align_of_internal(t->Enum.base_type, path);
 
 	case Type_Union: {
+		if (t->cached_align > 0) {
+			return t->cached_align.load();
+		}
 		if (t->Union.variants.count == 0) {
 			return 1;
 		}
@@ -3933,6 +4051,9 @@ gb_internal i64 type_align_of_internal(Type *t, TypePath *path) {
 	} break;
 
 	case Type_Struct: {
+		if (t->cached_align > 0) {
+			return t->cached_align.load();
+		}
 		if (t->Struct.custom_align > 0) {
 			return gb_max(t->Struct.custom_align, 1);
 		}
@@ -4070,6 +4191,27 @@ gb_internal bool type_set_offsets(Type *t) {
 	return false;
 }
 
+// NOTE: Computes and caches the layout of the record type `t` without taking `g_type_mutex`. The caller must
+// make sure nothing else is laying out `t` and that every record it contains by value is already cached.
+gb_internal void type_cache_layout(Type *t) {
+	GB_ASSERT(t->kind == Type_Struct || t->kind == Type_Union);
+
+	TypePath path{};
+	type_path_init(&path);
+	defer (type_path_free(&path));
+
+	if (t->kind == Type_Struct) {
+		type_set_offsets(t);
+	}
+	i64 align = type_align_of_internal(t, &path);
+	i64 size  = type_size_of_internal(t, &path);
+	if (path.failure) {
+		return;
+	}
+	t->cached_align.store(align);
+	t->cached_size.store(size);
+}
+
 gb_internal i64 type_size_of_internal(Type *t, TypePath *path) {
 	if (t->failure) {
 		return FAILURE_SIZE;
@@ -4178,6 +4320,9 @@ gb_internal i64 type_size_of_internal(Type *t, TypePath *path) {
 		return type_size_of_internal(t->Enum.base_type, path);
 
 	case Type_Union: {
+		if (t->cached_size >= 0) {
+			return t->cached_size.load();
+		}
 		if (t->Union.variants.count == 0) {
 			return 0;
 		}
@@ -4218,6 +4363,9 @@ gb_internal i64 type_size_of_internal(Type *t, TypePath *path) {
 
 
 	case Type_Struct: {
+		if (t->cached_size >= 0) {
+			return t->cached_size.load();
+		}
 		if (t->Struct.is_raw_union) {
 			i64 count = t->Struct.fields.count;
 			i64 align = type_align_of_internal(t, path);
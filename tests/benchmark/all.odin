@@ -1,6 +1,7 @@
 package benchmarks
 
 @(require) import "bytes"
+@(require) import "codegen"
 @(require) import "crypto"
 @(require) import "hash"
 @(require) import "text/regex"
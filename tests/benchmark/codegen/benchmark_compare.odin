@@ -0,0 +1,94 @@
+package benchmark_codegen
+
+import "base:runtime"
+import "core:fmt"
+import "core:log"
+import "core:testing"
+import "core:strings"
+import "core:text/table"
+import "core:time"
+
+RUNS :: 2000
+COUNT :: 1024
+
+// Shapes of simple-compare records: padded, odd-sized, word-sized and vector-sized,
+// and one just above the size which is compared inline.
+Rec_Padded :: struct { a: u32, b: u16 }
+Rec_12     :: struct { a: [3]u32 }
+Rec_16     :: struct { a, b: u64 }
+Rec_24     :: struct { a: [3]u64 }
+Rec_33     :: struct { a: [33]u8 }
+Rec_64     :: struct { a: [8]u64 }
+Rec_65     :: struct { a: [65]u8 }
+
+run_trial_compare :: proc($T: typeid, inline_compare: bool) -> (timing: time.Duration) {
+	left  := make([]T, COUNT)
+	right := make([]T, COUNT)
+	defer {
+		delete(left)
+		delete(right)
+	}
+
+	// Make every other record differ in its last byte
+	for i := 0; i < COUNT; i += 2 {
+		bytes := ([^]u8)(&right[i])
+		bytes[size_of(T)-1] = 1
+	}
+
+	equal: int
+
+	watch: time.Stopwatch
+	time.stopwatch_start(&watch)
+	for _ in 0..<RUNS {
+		for i in 0..<COUNT {
+			if inline_compare {
+				equal += int(left[i] == right[i])
+			} else {
+				equal += int(runtime.memory_equal(&left[i], &right[i], size_of(T)))
+			}
+		}
+	}
+	time.stopwatch_stop(&watch)
+	timing = time.stopwatch_duration(watch)
+
+	assert(equal == RUNS*COUNT/2)
+	return
+}
+
+bench_row :: proc(tbl: ^table.Table, name: string, $T: typeid) {
+	call_timing   := run_trial_compare(T, false)
+	inline_timing := run_trial_compare(T, true)
+
+	_call   := fmt.tprintf("%8M", call_timing)
+	_inline := fmt.tprintf("%8M", inline_timing)
+	_relx   := fmt.tprintf("%.3f x", 1 / (f64(inline_timing) / f64(call_timing)))
+
+	table.aligned_row_of_values(tbl, .Right, name, size_of(T), RUNS*COUNT, _call, _inline, _relx)
+}
+
+@test
+benchmark_record_compare :: proc(t: ^testing.T) {
+	string_buffer := strings.builder_make()
+	defer strings.builder_destroy(&string_buffer)
+
+	tbl: table.Table
+	table.init(&tbl)
+	defer table.destroy(&tbl)
+
+	table.aligned_header_of_values(&tbl, .Right, "Record", "Size", "Compares", "memory_equal", "==", "Relative (x)")
+
+	bench_row(&tbl, "Rec_Padded", Rec_Padded)
+	bench_row(&tbl, "Rec_12",     Rec_12)
+	bench_row(&tbl, "Rec_16",     Rec_16)
+	bench_row(&tbl, "Rec_24",     Rec_24)
+	bench_row(&tbl, "Rec_33",     Rec_33)
+	bench_row(&tbl, "Rec_64",     Rec_64)
+	bench_row(&tbl, "Rec_65",     Rec_65)
+
+	builder_writer := strings.to_writer(&string_buffer)
+
+	fmt.sbprintln(&string_buffer)
+	table.write_plain_table(builder_writer, &tbl)
+
+	log.info(strings.to_string(string_buffer))
+}
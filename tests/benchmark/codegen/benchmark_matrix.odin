@@ -0,0 +1,100 @@
+package benchmark_codegen
+
+import "core:fmt"
+import "core:log"
+import "core:testing"
+import "core:strings"
+import "core:text/table"
+import "core:time"
+
+MATRIX_RUNS :: 20000
+MATRIX_COUNT :: 64
+
+// Hand-written equivalent of `a * b` on plain arrays, indexed [row][column]
+array_mat_mul :: proc "contextless" (a, b: ^[$N][N]f32) -> (c: [N][N]f32) {
+	for i in 0..<N {
+		for j in 0..<N {
+			sum: f32
+			for k in 0..<N {
+				sum += a[i][k] * b[k][j]
+			}
+			c[i][j] = sum
+		}
+	}
+	return
+}
+
+run_trial_matrix :: proc($M: typeid/matrix[$N, N]f32, builtin: bool) -> (timing: time.Duration) {
+	mats   := make([]M, MATRIX_COUNT)
+	arrays := make([][N][N]f32, MATRIX_COUNT)
+	defer {
+		delete(mats)
+		delete(arrays)
+	}
+	for &m, n in mats {
+		for i in 0..<N {
+			for j in 0..<N {
+				m[i, j] = f32((i + j + n) % 5) * 0.25
+				arrays[n][i][j] = m[i, j]
+			}
+		}
+	}
+
+	checksum: f32
+
+	watch: time.Stopwatch
+	time.stopwatch_start(&watch)
+	for _ in 0..<MATRIX_RUNS {
+		for n in 1..<MATRIX_COUNT {
+			if builtin {
+				c := mats[n-1] * mats[n]
+				checksum += c[N-1, N-1]
+			} else {
+				c := array_mat_mul(&arrays[n-1], &arrays[n])
+				checksum += c[N-1][N-1]
+			}
+		}
+	}
+	time.stopwatch_stop(&watch)
+	timing = time.stopwatch_duration(watch)
+
+	assert(checksum >= 0)
+	return
+}
+
+matrix_bench_row :: proc(tbl: ^table.Table, name: string, $M: typeid) {
+	array_timing   := run_trial_matrix(M, false)
+	builtin_timing := run_trial_matrix(M, true)
+
+	_array   := fmt.tprintf("%8M", array_timing)
+	_builtin := fmt.tprintf("%8M", builtin_timing)
+	_relx    := fmt.tprintf("%.3f x", 1 / (f64(builtin_timing) / f64(array_timing)))
+
+	table.aligned_row_of_values(tbl, .Right, name, MATRIX_RUNS*(MATRIX_COUNT-1), _array, _builtin, _relx)
+}
+
+@test
+benchmark_matrix_mul :: proc(t: ^testing.T) {
+	string_buffer := strings.builder_make()
+	defer strings.builder_destroy(&string_buffer)
+
+	tbl: table.Table
+	table.init(&tbl)
+	defer table.destroy(&tbl)
+
+	table.aligned_header_of_values(&tbl, .Right, "Matrix", "Products", "[N][N]f32", "matrix", "Relative (x)")
+
+	matrix_bench_row(&tbl, "4x4",            matrix[4, 4]f32)
+	matrix_bench_row(&tbl, "#row_major 4x4", #row_major matrix[4, 4]f32)
+	matrix_bench_row(&tbl, "6x6",            matrix[6, 6]f32)
+	matrix_bench_row(&tbl, "#row_major 6x6", #row_major matrix[6, 6]f32)
+	matrix_bench_row(&tbl, "8x8",            matrix[8, 8]f32)
+	matrix_bench_row(&tbl, "#row_major 8x8", #row_major matrix[8, 8]f32)
+
+	builder_writer := strings.to_writer(&string_buffer)
+
+	fmt.sbprintln(&string_buffer)
+	table.write_plain_table(builder_writer, &tbl)
+
+	log.info(strings.to_string(string_buffer))
+}
@@ -0,0 +1,475 @@
+/*
+Measures the compiler itself rather than the code it produces.
+
+Large synthetic programs are generated into a work directory. Each one is
+passed to `odin check` (and, with `-build`, to `odin build`) using
+`-export-timings:json`. The benchmark records the wall time, the time for each
+compiler phase, the peak resident set size and the thread count. The minimum
+over all runs is kept.
+
+The results are written as JSON. If `-baseline` names an earlier results
+file, any scenario slower or larger than that baseline by more than the
+tolerance is reported. The program then exits with a non-zero status.
+
+	odin run tests/compiler_benchmark -- -odin:./odin -build -out:new.json -baseline:old.json
+*/
+package compiler_benchmark
+
+import "core:encoding/json"
+import "core:flags"
+import "core:fmt"
+import os "core:os/os2"
+import "core:strings"
+import "core:time"
+
+Options :: struct {
+	odin:      string `usage:"Path to the odin executable to benchmark."`,
+	work:      string `usage:"Directory in which the synthetic programs are generated."`,
+	out:       string `usage:"File the results are written to."`,
+	baseline:  string `usage:"Results file from an earlier run to compare against."`,
+	tolerance: f64    `usage:"Allowed slowdown or memory growth over the baseline, in percent."`,
+	noise:     f64    `usage:"Differences below this many milliseconds are never a regression."`,
+	scale:     int    `usage:"Multiplies the size of every generated program."`,
+	runs:      int    `usage:"Number of times each command is run; the fastest run is kept."`,
+	threads:   int    `usage:"Passed as -thread-count when not zero."`,
+	build:     bool   `usage:"Also run 'odin build' to measure the backend."`,
+}
+
+Phase :: struct {
+	name:   string,
+	millis: f64,
+}
+
+Result :: struct {
+	scenario:     string,
+	command:      string,
+	lines:        i64,
+	wall_millis:  f64,
+	peak_memory:  i64,
+	thread_count: i64,
+	phases:       []Phase,
+}
+
+Results :: struct {
+	results: []Result,
+}
+
+// NOTE: the layout of the file written by `-export-timings:json`
+Exported_Timings :: struct {
+	totals: []struct {
+		name:  string,
+		count: i64,
+	},
+	timings: []Phase,
+}
+
+Scenario :: struct {
+	name:     string,
+	generate: proc(dir: string, scale: int),
+}
+
+SCENARIOS := [?]Scenario{
+	{"many_packages",    generate_many_packages},
+	{"deep_generics",    generate_deep_generics},
+	{"huge_enum_switch", generate_huge_enum_switch},
+	{"giant_structs",    generate_giant_structs},
+	{"many_procs",       generate_many_procs},
+	{"many_globals",     generate_many_globals},
+}
+
+errorf :: proc(format: string, args: ..any) -> ! {
+	fmt.eprintf("%s ", os.args[0])
+	fmt.eprintf(format, ..args)
+	fmt.eprintln()
+	os.exit(1)
+}
+
+write_file :: proc(dir, name: string, b: ^strings.Builder) {
+	path, _ := os.join_path({dir, name}, context.temp_allocator)
+	if err := os.write_entire_file(path, transmute([]byte)strings.to_string(b^)); err != nil {
+		errorf("unable to write %s: %v", path, err)
+	}
+	strings.builder_reset(b)
+}
+
+make_dir :: proc(elems: ..string) -> string {
+	path, _ := os.join_path(elems, context.allocator)
+	if err := os.make_directory_all(path); err != nil && err != .Exist {
+		errorf("unable to create %s: %v", path, err)
+	}
+	return path
+}
+
+// A chain of packages, each importing the previous one, all imported by `main`
+generate_many_packages :: proc(dir: string, scale: int) {
+	PROCS_PER_PACKAGE :: 32
+	count := 48*scale
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	for i in 0..<count {
+		pkg_dir := make_dir(dir, fmt.tprintf("pkg_%d", i))
+		fmt.sbprintf(&b, "package pkg_%d\n\n", i)
+		if i > 0 {
+			fmt.sbprintf(&b, "import prev \"../pkg_%d\"\n\n", i-1)
+		}
+		fmt.sbprintf(&b, "Data :: struct {{\n\tid: int,\n\tname: string,\n\tvalues: [dynamic]f32,\n}}\n\n")
+		for j in 0..<PROCS_PER_PACKAGE {
+			fmt.sbprintf(&b, "proc_%d :: proc(d: ^Data, x: int) -> int {{\n", j)
+			fmt.sbprintf(&b, "\td.id += x * %d\n", j+1)
+			fmt.sbprintf(&b, "\tfor v, k in d.values {{\n\t\td.id += int(v) + k\n\t}}\n")
+			if i > 0 && j == 0 {
+				fmt.sbprintf(&b, "\tp: prev.Data\n\td.id += prev.proc_%d(&p, x)\n", PROCS_PER_PACKAGE-1)
+			} else if j > 0 {
+				fmt.sbprintf(&b, "\td.id += proc_%d(d, x-1)\n", j-1)
+			}
+			fmt.sbprintf(&b, "\treturn d.id\n}}\n\n")
+		}
+		write_file(pkg_dir, "pkg.odin", &b)
+	}
+
+	fmt.sbprintf(&b, "package main\n\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "import \"pkg_%d\"\n", i)
+	}
+	fmt.sbprintf(&b, "\nmain :: proc() {{\n\ttotal := 0\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "\t{{\n\t\td: pkg_%d.Data\n\t\ttotal += pkg_%d.proc_%d(&d, %d)\n\t}}\n", i, i, PROCS_PER_PACKAGE-1, i)
+	}
+	fmt.sbprintf(&b, "\t_ = total\n}}\n")
+	write_file(dir, "main.odin", &b)
+}
+
+// Deeply nested parametric procedures and records, each specialized for many types
+generate_deep_generics :: proc(dir: string, scale: int) {
+	DEPTH :: 32
+	array_count := 48*scale
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	fmt.sbprintf(&b, "package main\n\n")
+	fmt.sbprintf(&b, "Node :: struct($T: typeid) {{\n\tvalue: T,\n\tnext:  ^Node(T),\n}}\n\n")
+	fmt.sbprintf(&b, "Pair :: struct($A, $B: typeid) {{\n\ta: A,\n\tb: B,\n}}\n\n")
+	fmt.sbprintf(&b, "level_0 :: proc(x: $T) -> Node(T) {{\n\treturn {{value = x}}\n}}\n\n")
+	for i in 1..<DEPTH {
+		fmt.sbprintf(&b, "level_%d :: proc(x: $T) -> Node(T) {{\n", i)
+		fmt.sbprintf(&b, "\tn := level_%d(x)\n\tp := Pair(T, Node(T)){{x, n}}\n\treturn {{value = p.a, next = nil}}\n}}\n\n", i-1)
+	}
+	fmt.sbprintf(&b, "Nest_0 :: Node(int)\n")
+	for i in 1..<DEPTH {
+		fmt.sbprintf(&b, "Nest_%d :: Node(Pair(Nest_%d, [%d]int))\n", i, i-1, i)
+	}
+	fmt.sbprintf(&b, "\nmain :: proc() {{\n")
+	for i in 1..=array_count {
+		fmt.sbprintf(&b, "\t_ = level_%d([%d]int{{}})\n", DEPTH-1, i)
+	}
+	for type in ([]string{"i8", "i16", "i32", "i64", "u8", "u16", "u32", "u64", "f32", "f64", "string", "rawptr"}) {
+		fmt.sbprintf(&b, "\t_ = level_%d(%s{{}})\n", DEPTH-1, type)
+	}
+	fmt.sbprintf(&b, "\tn: Nest_%d\n\t_ = level_%d(n)\n", DEPTH-1, DEPTH-1)
+	fmt.sbprintf(&b, "}}\n")
+	write_file(dir, "main.odin", &b)
+}
+
+// One very large enumeration matched exhaustively, plus a string switch over its names
+generate_huge_enum_switch :: proc(dir: string, scale: int) {
+	count := 4096*scale
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	fmt.sbprintf(&b, "package main\n\nimport \"core:fmt\"\n\nBig :: enum u32 {{\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "\tValue_%d,\n", i)
+	}
+	fmt.sbprintf(&b, "}}\n\nbig_weight :: proc(b: Big) -> int {{\n\tswitch b {{\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "\tcase .Value_%d: return %d\n", i, (i*7919)%1021)
+	}
+	fmt.sbprintf(&b, "\t}}\n\treturn -1\n}}\n\nbig_from_string :: proc(s: string) -> (Big, bool) {{\n\tswitch s {{\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "\tcase \"Value_%d\": return .Value_%d, true\n", i, i)
+	}
+	fmt.sbprintf(&b, "\t}}\n\treturn nil, false\n}}\n\n")
+	fmt.sbprintf(&b, "main :: proc() {{\n\ttotal := 0\n\tfor b in Big {{\n\t\ttotal += big_weight(b)\n\t}}\n")
+	fmt.sbprintf(&b, "\tb, _ := big_from_string(\"Value_%d\")\n\tfmt.println(total, b)\n}}\n", count/2)
+	write_file(dir, "main.odin", &b)
+}
+
+// A few records with thousands of fields, built from compound literals
+generate_giant_structs :: proc(dir: string, scale: int) {
+	STRUCT_COUNT :: 4
+	field_count := 1024*scale
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	types := [?]string{"int", "f32", "bool", "[4]u8", "string", "^int", "[2]f64", "u16"}
+
+	fmt.sbprintf(&b, "package main\n\n")
+	for s in 0..<STRUCT_COUNT {
+		fmt.sbprintf(&b, "Giant_%d :: struct {{\n", s)
+		for i in 0..<field_count {
+			fmt.sbprintf(&b, "\tfield_%d: %s,\n", i, types[(i+s)%len(types)])
+		}
+		fmt.sbprintf(&b, "}}\n\n")
+
+		fmt.sbprintf(&b, "make_giant_%d :: proc() -> (g: Giant_%d) {{\n\tg = {{\n", s, s)
+		for i in 0..<field_count {
+			if types[(i+s)%len(types)] == "int" {
+				fmt.sbprintf(&b, "\t\tfield_%d = %d,\n", i, i)
+			}
+		}
+		fmt.sbprintf(&b, "\t}}\n\treturn\n}}\n\n")
+
+		fmt.sbprintf(&b, "sum_giant_%d :: proc(g: ^Giant_%d) -> (total: int) {{\n", s, s)
+		for i in 0..<field_count {
+			if types[(i+s)%len(types)] == "int" {
+				fmt.sbprintf(&b, "\ttotal += g.field_%d\n", i)
+			}
+		}
+		fmt.sbprintf(&b, "\treturn\n}}\n\n")
+	}
+	fmt.sbprintf(&b, "main :: proc() {{\n\ttotal := 0\n")
+	for s in 0..<STRUCT_COUNT {
+		fmt.sbprintf(&b, "\t{{\n\t\tg := make_giant_%d()\n\t\ttotal += sum_giant_%d(&g)\n\t}}\n", s, s)
+	}
+	fmt.sbprintf(&b, "\t_ = total\n}}\n")
+	write_file(dir, "main.odin", &b)
+}
+
+// Thousands of small procedures spread over several files, all reachable from `main`
+generate_many_procs :: proc(dir: string, scale: int) {
+	FILE_COUNT :: 16
+	count := 16384*scale
+	per_file := (count + FILE_COUNT-1)/FILE_COUNT
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	for f in 0..<FILE_COUNT {
+		fmt.sbprintf(&b, "package main\n\n")
+		for i in f*per_file..<min((f+1)*per_file, count) {
+			fmt.sbprintf(&b, "proc_%d :: proc(x: int) -> int {{\n", i)
+			if i == 0 {
+				fmt.sbprintf(&b, "\treturn x\n}}\n\n")
+			} else {
+				fmt.sbprintf(&b, "\tif x > %d {{\n\t\treturn proc_%d(x - 1) * 3\n\t}}\n\treturn x + %d\n}}\n\n", i%97, i/2, i)
+			}
+		}
+		write_file(dir, fmt.tprintf("procs_%d.odin", f), &b)
+	}
+
+	fmt.sbprintf(&b, "package main\n\nPROCS := [?]proc(int) -> int{{\n")
+	for i in 0..<count {
+		fmt.sbprintf(&b, "\tproc_%d,\n", i)
+	}
+	fmt.sbprintf(&b, "}}\n\nmain :: proc() {{\n\ttotal := 0\n\tfor p, i in PROCS {{\n\t\ttotal += p(i)\n\t}}\n\t_ = total\n}}\n")
+	write_file(dir, "main.odin", &b)
+}
+
+// A hundred thousand global variables whose initializers refer to earlier ones, to later ones and to
+// procedures, so that their initialization order has to be worked out
+generate_many_globals :: proc(dir: string, scale: int) {
+	FILE_COUNT :: 16
+	READERS    :: 64
+	count := 100_000*scale
+	per_file := (count + FILE_COUNT-1)/FILE_COUNT
+
+	b := strings.builder_make()
+	defer strings.builder_destroy(&b)
+
+	// Only globals with `i%5 == 0` are referred to from later in the source or from a procedure, so there are no cycles
+	leaf :: proc(i, count: int) -> int {
+		return (i%count)/5*5
+	}
+
+	for f in 0..<FILE_COUNT {
+		fmt.sbprintf(&b, "package main\n\n")
+		for i in f*per_file..<min((f+1)*per_file, count) {
+			switch i%5 {
+			case 0: fmt.sbprintf(&b, "global_%d: int = %d\n", i, i)
+			case 1: fmt.sbprintf(&b, "global_%d: int = global_%d + 1\n", i, leaf(i*7919, count))
+			case 2: fmt.sbprintf(&b, "global_%d: int = global_%d + global_%d\n", i, i-1, i/2)
+			case 3: fmt.sbprintf(&b, "global_%d: int = read_%d() - global_%d\n", i, i%READERS, i-3)
+			case 4: fmt.sbprintf(&b, "global_%d: [2]int = {{global_%d, global_%d}}\n", i, i-2, leaf(i*31 + 5, count))
+			}
+		}
+		write_file(dir, fmt.tprintf("globals_%d.odin", f), &b)
+	}
+
+	fmt.sbprintf(&b, "package main\n\n")
+	for r in 0..<READERS {
+		fmt.sbprintf(&b, "read_%d :: proc() -> int {{\n\treturn global_%d\n}}\n\n", r, leaf(r*count/READERS + count/2, count))
+	}
+	fmt.sbprintf(&b, "main :: proc() {{\n\t_ = global_%d\n}}\n", count-1)
+	write_file(dir, "main.odin", &b)
+}
+
+// Runs the compiler once and returns the timings it exported
+run_compiler :: proc(opt: Options, command, dir: string) -> (result: Result) {
+	timings_path, _ := os.join_path({dir, "timings.json"}, context.temp_allocator)
+	exe_path, _     := os.join_path({dir, "benchmark.bin"}, context.temp_allocator)
+
+	args := make([dynamic]string, context.temp_allocator)
+	append(&args, opt.odin, command, dir, "-show-timings", "-export-timings:json")
+	append(&args, fmt.tprintf("-export-timings-file:%s", timings_path))
+	if command == "build" {
+		append(&args, fmt.tprintf("-out:%s", exe_path))
+	}
+	if opt.threads != 0 {
+		append(&args, fmt.tprintf("-thread-count:%d", opt.threads))
+	}
+
+	start := time.tick_now()
+	state, _, stderr, err := os.process_exec({command = args[:]}, context.temp_allocator)
+	wall := time.tick_since(start)
+	if err != nil {
+		errorf("unable to run %s: %v", opt.odin, err)
+	}
+	if !state.success || state.exit_code != 0 {
+		errorf("'odin %s %s' failed:\n%s", command, dir, string(stderr))
+	}
+
+	data, read_err := os.read_entire_file(timings_path, context.temp_allocator)
+	if read_err != nil {
+		errorf("unable to read %s: %v", timings_path, read_err)
+	}
+	exported: Exported_Timings
+	if json_err := json.unmarshal(data, &exported); json_err != nil {
+		errorf("unable to parse %s: %v", timings_path, json_err)
+	}
+
+	result.command     = command
+	result.wall_millis = time.duration_milliseconds(wall)
+	result.phases      = exported.timings
+	for total in exported.totals {
+		switch total.name {
+		case "total_lines":  result.lines        = total.count
+		case "peak_memory":  result.peak_memory  = total.count
+		case "thread_count": result.thread_count = total.count
+		}
+	}
+	return
+}
+
+// Keeps the fastest of `a` and `b` for every measurement
+merge_fastest :: proc(a: ^Result, b: Result) {
+	a.wall_millis = min(a.wall_millis, b.wall_millis)
+	a.peak_memory = min(a.peak_memory, b.peak_memory)
+	for &phase in a.phases {
+		for other in b.phases {
+			if other.name == phase.name {
+				phase.millis = min(phase.millis, other.millis)
+			}
+		}
+	}
+}
+
+is_regression :: proc(opt: Options, current, baseline: f64, noise: f64) -> bool {
+	return current > baseline*(1 + opt.tolerance/100) && current-baseline > noise
+}
+
+compare_with_baseline :: proc(opt: Options, results: []Result) -> (regressions: int) {
+	data, err := os.read_entire_file(opt.baseline, context.allocator)
+	if err != nil {
+		errorf("unable to read baseline %s: %v", opt.baseline, err)
+	}
+	baseline: Results
+	if json_err := json.unmarshal(data, &baseline); json_err != nil {
+		errorf("unable to parse baseline %s: %v", opt.baseline, json_err)
+	}
+
+	report :: proc(r: Result, what: string, current, previous: f64, unit: string, regressed: bool) {
+		fmt.printf("%-18s %-6s %-24s %.3f %s -> %.3f %s (%+.1f%%)%s\n",
+		           r.scenario, r.command, what, previous, unit, current, unit,
+		           previous != 0 ? 100*(current-previous)/previous : 0,
+		           regressed ? "  REGRESSION" : "")
+	}
+
+	fmt.println("\nComparison against", opt.baseline)
+	for r in results {
+		for old in baseline.results {
+			if old.scenario != r.scenario || old.command != r.command {
+				continue
+			}
+			regressed := is_regression(opt, r.wall_millis, old.wall_millis, opt.noise)
+			report(r, "wall time", r.wall_millis, old.wall_millis, "ms", regressed)
+			regressions += int(regressed)
+
+			for phase in r.phases {
+				for old_phase in old.phases {
+					if old_phase.name == phase.name {
+						regressed = is_regression(opt, phase.millis, old_phase.millis, opt.noise)
+						report(r, phase.name, phase.millis, old_phase.millis, "ms", regressed)
+						regressions += int(regressed)
+					}
+				}
+			}
+
+			MIB :: 1024*1024
+			regressed = is_regression(opt, f64(r.peak_memory), f64(old.peak_memory), MIB)
+			report(r, "peak memory", f64(r.peak_memory)/MIB, f64(old.peak_memory)/MIB, "MiB", regressed)
+			regressions += int(regressed)
+		}
+	}
+	return
+}
+
+main :: proc() {
+	opt := Options{
+		odin      = "odin",
+		work      = "compiler_benchmark_work",
+		out       = "compiler_benchmark.json",
+		tolerance = 10,
+		noise     = 10,
+		scale     = 1,
+		runs      = 3,
+	}
+	flags.parse_or_exit(&opt, os.args, .Odin)
+	if opt.scale < 1 || opt.runs < 1 {
+		errorf("-scale and -runs must be at least 1")
+	}
+
+	commands: []string = opt.build ? {"check", "build"} : {"check"}
+	results := make([dynamic]Result)
+
+	for scenario in SCENARIOS {
+		dir := make_dir(opt.work, scenario.name)
+		scenario.generate(dir, opt.scale)
+
+		for command in commands {
+			result := run_compiler(opt, command, dir)
+			for _ in 1..<opt.runs {
+				merge_fastest(&result, run_compiler(opt, command, dir))
+			}
+			result.scenario = scenario.name
+
+			fmt.printf("%-18s %-6s %d lines, %.3f ms, %.3f MiB, %d thread(s)\n",
+			           result.scenario, result.command, result.lines, result.wall_millis,
+			           f64(result.peak_memory)/(1024*1024), result.thread_count)
+			for phase in result.phases {
+				fmt.printf("    %-32s %.3f ms\n", phase.name, phase.millis)
+			}
+			append(&results, result)
+			free_all(context.temp_allocator)
+		}
+	}
+
+	data, err := json.marshal(Results{results[:]}, {pretty = true})
+	if err != nil {
+		errorf("unable to encode the results: %v", err)
+	}
+	if write_err := os.write_entire_file(opt.out, data); write_err != nil {
+		errorf("unable to write %s: %v", opt.out, write_err)
+	}
+	fmt.println("\nResults written to", opt.out)
+
+	if opt.baseline != "" {
+		if regressions := compare_with_baseline(opt, results[:]); regressions > 0 {
+			errorf("%d measurement(s) regressed by more than %.1f%%", regressions, opt.tolerance)
+		}
+	}
+}
@@ -0,0 +1,74 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+expect_array_arith :: proc(t: ^testing.T, $N: int, $E: typeid, loc := #caller_location) {
+	a, b: [N]E
+	for i in 0..<N {
+		a[i] = E(i % 7 + 1)
+		b[i] = E(i % 5 + 2)
+	}
+
+	sum := a + b
+	diff := a - b
+	prod := a * b
+	for i in 0..<N {
+		testing.expect_value(t, sum[i],  a[i] + b[i], loc=loc)
+		testing.expect_value(t, diff[i], a[i] - b[i], loc=loc)
+		testing.expect_value(t, prod[i], a[i] * b[i], loc=loc)
+	}
+
+	c: [N]E
+	c = a + b
+	testing.expect_value(t, c, sum, loc=loc)
+	c = c * a
+	for i in 0..<N {
+		testing.expect_value(t, c[i], sum[i] * a[i], loc=loc)
+	}
+	c = a - c
+	for i in 0..<N {
+		testing.expect_value(t, c[i], a[i] - sum[i] * a[i], loc=loc)
+	}
+
+	d := a
+	d += b
+	testing.expect_value(t, d, sum, loc=loc)
+	d -= b
+	testing.expect_value(t, d, a, loc=loc)
+	d *= d
+	for i in 0..<N {
+		testing.expect_value(t, d[i], a[i] * a[i], loc=loc)
+	}
+}
+
+@(test)
+test_array_arith :: proc(t: ^testing.T) {
+	expect_array_arith(t, 256, f32)
+	expect_array_arith(t, 67,  f64)
+	expect_array_arith(t, 100, i32)
+	expect_array_arith(t, 37,  u8)
+	expect_array_arith(t, 19,  i64)
+
+	x, y: [129]u16
+	for i in 0..<len(x) {
+		x[i] = u16(i * 31)
+		y[i] = u16(i * 17)
+	}
+	z := x ~ y
+	w := x &~ y
+	for i in 0..<len(x) {
+		testing.expect_value(t, z[i], x[i] ~ y[i])
+		testing.expect_value(t, w[i], x[i] &~ y[i])
+	}
+
+	f, g: [100]f32
+	for i in 0..<len(f) {
+		f[i] = f32(i + 1)
+		g[i] = 2
+	}
+	h := f / g
+	for i in 0..<len(f) {
+		testing.expect_value(t, h[i], f[i] / 2)
+	}
+}
@@ -0,0 +1,35 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file") init_order_seen:  [8]int
+@(private="file") init_order_count: int
+
+@(private="file")
+init_order_note :: proc(id: int) -> int {
+	init_order_seen[init_order_count] = id
+	init_order_count += 1
+	return id
+}
+
+@(private="file")
+init_order_read_f :: proc() -> int {
+	return init_order_f
+}
+
+// NOTE: Of the globals whose dependencies are all initialized, the one earliest in the source always goes next
+@(private="file") init_order_e := init_order_note(5) + init_order_read_f()
+@(private="file") init_order_a := init_order_note(1)
+@(private="file") init_order_d := init_order_note(4) + init_order_b + init_order_c
+@(private="file") init_order_b := init_order_note(2)
+@(private="file") init_order_f := init_order_note(6) + init_order_a
+@(private="file") init_order_c := init_order_note(3)
+
+@(test)
+test_init_order :: proc(t: ^testing.T) {
+	testing.expect_value(t, init_order_count, 6)
+	testing.expect_value(t, init_order_seen, [8]int{1, 2, 6, 5, 3, 4, 0, 0})
+
+	testing.expect_value(t, init_order_d, 4 + 2 + 3)
+	testing.expect_value(t, init_order_e, 5 + 6 + 1)
+}
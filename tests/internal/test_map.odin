@@ -2,6 +2,7 @@ package test_internal
 
 import "core:log"
 import "base:intrinsics"
+import "base:runtime"
 import "core:math/rand"
 import "core:testing"
 
@@ -337,3 +338,85 @@ test_union_key_should_not_be_hashing_specifc_variant :: proc(t: ^testing.T) {
 	testing.expect_value(t, bone_1 in m, true)
 	testing.expect_value(t, Id(bone_1) in m, true)
 }
+
+@test
+test_map_constant_keys_hash_like_runtime_keys :: proc(t: ^testing.T) {
+	Op :: enum u16 { Nop, Add = 300, Sub }
+
+	strings := []string{"", "a", "hello", "a key of exactly thirty-two byte", "\x00\xff", "a key which is too long to be hashed inline"}
+	s: map[string]int
+	defer delete(s)
+	for k, i in strings {
+		s[k] = i
+	}
+	testing.expect_value(t, s[""], 0)
+	testing.expect_value(t, s["a"], 1)
+	testing.expect_value(t, s["hello"], 2)
+	testing.expect_value(t, s["a key of exactly thirty-two byte"], 3)
+	testing.expect_value(t, s["\x00\xff"], 4)
+	testing.expect_value(t, s["a key which is too long to be hashed inline"], 5)
+	testing.expect_value(t, "missing" in s, false)
+
+	cstrings := []cstring{"", "abc"}
+	c: map[cstring]int
+	defer delete(c)
+	for k, i in cstrings {
+		c[k] = i + 1
+	}
+	testing.expect_value(t, c[""], 1)
+	testing.expect_value(t, c["abc"], 2)
+
+	ops := []Op{.Nop, .Add, .Sub}
+	o: map[Op]int
+	defer delete(o)
+	for k, i in ops {
+		o[k] = i + 1
+	}
+	testing.expect_value(t, o[.Nop], 1)
+	testing.expect_value(t, o[.Add], 2)
+	testing.expect_value(t, o[.Sub], 3)
+
+	ints := []i64{0, -1, 1 << 40}
+	n: map[i64]int
+	defer delete(n)
+	for k, i in ints {
+		n[k] = i + 1
+	}
+	testing.expect_value(t, n[0], 1)
+	testing.expect_value(t, n[-1], 2)
+	testing.expect_value(t, n[1 << 40], 3)
+
+	be := []u32be{0x01020304}
+	b: map[u32be]int
+	defer delete(b)
+	for k in be {
+		b[k] = 7
+	}
+	testing.expect_value(t, b[0x01020304], 7)
+}
+
+@test
+test_generated_hashers_match_runtime_hashers :: proc(t: ^testing.T) {
+	Small :: struct { a: u32, b: u16 }
+	Mixed :: struct { a: [2]i32, s: string, e: enum u8 { A, B }, big: [40]u8 }
+
+	seeds := []uintptr{0, 1, 0xdeadbeef, max(uintptr)}
+	for seed in seeds {
+		v2 := [2]i32{-7, 1 << 20}
+		testing.expect_value(t, intrinsics.type_hasher_proc([2]i32)(&v2, seed), runtime.default_hasher(&v2, seed, size_of(v2)))
+
+		small := Small{a = 0x01020304, b = 0xfffe}
+		testing.expect_value(t, intrinsics.type_hasher_proc(Small)(&small, seed), runtime.default_hasher(&small, seed, size_of(small)))
+
+		b: u8 = 0x80
+		testing.expect_value(t, intrinsics.type_hasher_proc(u8)(&b, seed), runtime.default_hasher(&b, seed, size_of(b)))
+
+		mixed := Mixed{a = {3, -4}, s = "key", e = .B}
+		mixed.big[39] = 1
+		h := runtime.default_hasher(&mixed.a, seed, size_of(mixed.a))
+		h  = runtime.default_hasher_string(&mixed.s, h)
+		h  = runtime.default_hasher(&mixed.e, h, size_of(mixed.e))
+		h  = runtime.default_hasher(&mixed.big, h, size_of(mixed.big))
+		testing.expect_value(t, intrinsics.type_hasher_proc(Mixed)(&mixed, seed), h)
+	}
+}
@@ -0,0 +1,88 @@
+package test_internal
+
+import "base:runtime"
+import "core:testing"
+
+// NOTE: Overwrites every freed block, so that reading a map's old cells after it has grown is caught
+@(private="file")
+poison_on_free :: proc(allocator_data: rawptr, mode: runtime.Allocator_Mode, size, alignment: int,
+                       old_memory: rawptr, old_size: int, loc := #caller_location) -> ([]byte, runtime.Allocator_Error) {
+	backing := (^runtime.Allocator)(allocator_data)
+	if mode == .Free && old_memory != nil {
+		runtime.memset(old_memory, 0xab, old_size)
+	}
+	return backing.procedure(backing.data, mode, size, alignment, old_memory, old_size, loc)
+}
+
+@(test)
+test_map_range :: proc(t: ^testing.T) {
+	m: map[int]int
+	defer delete(m)
+
+	for k in m {
+		testing.expectf(t, false, "unexpected key %v in an empty map", k)
+	}
+
+	N :: 1000
+	for i in 0..<N {
+		m[i] = i*i
+	}
+	for i := 0; i < N; i += 3 {
+		delete_key(&m, i)
+	}
+
+	keys, values, pairs: int
+	for k in m {
+		keys += k
+	}
+	for _, v in m {
+		values += v
+	}
+	for k, &v in m {
+		pairs += 1
+		testing.expect_value(t, v, k*k)
+		v += 1
+	}
+
+	expected_keys, expected_values: int
+	for i in 0..<N {
+		if i % 3 != 0 {
+			expected_keys += i
+			expected_values += i*i
+		}
+	}
+	testing.expect_value(t, keys, expected_keys)
+	testing.expect_value(t, values, expected_values)
+	testing.expect_value(t, pairs, len(m))
+	for k, v in m {
+		testing.expect_value(t, v, k*k + 1)
+	}
+
+	// NOTE: Entries deleted by the body must not be visited later in the same loop
+	visited := 0
+	for k in m {
+		visited += 1
+		delete_key(&m, k ~ 1)
+	}
+	testing.expect_value(t, visited, len(m))
+
+	// NOTE: A body which inserts may grow the map, after which the loop must continue over the new cells
+	backing := context.allocator
+	grown := make(map[int]int, runtime.Allocator{poison_on_free, &backing})
+	defer delete(grown)
+	for i in 0..<4 {
+		grown[i] = i*10
+	}
+	visited = 0
+	for k, v in grown {
+		if visited == 0 {
+			for i in 100..<200 {
+				grown[i] = i*10
+			}
+		}
+		visited += 1
+		testing.expect_value(t, v, k*10)
+	}
+	testing.expect(t, visited >= 4)
+	testing.expect_value(t, len(grown), 104)
+}
@@ -0,0 +1,75 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+mat_mul_reference :: proc(a: $A/matrix[$R, $K]$E, b: $B/matrix[K, $C]E, c: ^$M/matrix[R, C]E) {
+	for i in 0..<R {
+		for j in 0..<C {
+			for k in 0..<K {
+				c[i, j] += a[i, k] * b[k, j]
+			}
+		}
+	}
+}
+
+@(private="file")
+fill_matrix :: proc(m: ^$M/matrix[$R, $C]$E, seed: int) {
+	for i in 0..<R {
+		for j in 0..<C {
+			m[i, j] = E((i*7 + j*3 + seed) % 11) - 5
+		}
+	}
+}
+
+@(private="file")
+expect_large_matrix_products :: proc(t: ^testing.T, $E: typeid, $N: int) {
+	a, b: matrix[N, N]E
+	fill_matrix(&a, 1)
+	fill_matrix(&b, 2)
+	ab: matrix[N, N]E
+	mat_mul_reference(a, b, &ab)
+	testing.expect(t, a * b == ab)
+
+	ra, rb: #row_major matrix[N, N]E
+	fill_matrix(&ra, 1)
+	fill_matrix(&rb, 2)
+	rab: #row_major matrix[N, N]E
+	mat_mul_reference(ra, rb, &rab)
+	testing.expect(t, ra * rb == rab)
+
+	v: [N]E
+	for &x, i in v {
+		x = E(i) - 2
+	}
+	mv, rmv, vm, vrm: [N]E
+	for i in 0..<N {
+		for j in 0..<N {
+			mv[i]  += a[i, j] * v[j]
+			rmv[i] += ra[i, j] * v[j]
+			vm[j]  += v[i] * a[i, j]
+			vrm[j] += v[i] * ra[i, j]
+		}
+	}
+	testing.expect(t, a * v == mv)
+	testing.expect(t, ra * v == rmv)
+	testing.expect(t, v * a == vm)
+	testing.expect(t, v * ra == vrm)
+}
+
+@(test)
+test_matrix_large :: proc(t: ^testing.T) {
+	expect_large_matrix_products(t, f32, 6)
+	expect_large_matrix_products(t, f32, 8)
+	expect_large_matrix_products(t, f64, 8)
+	expect_large_matrix_products(t, i32, 6)
+
+	// NOTE: The result fits the unrolled form but the operands do not
+	a: matrix[4, 16]f32
+	b: matrix[16, 4]f32
+	fill_matrix(&a, 3)
+	fill_matrix(&b, 4)
+	ab: matrix[4, 4]f32
+	mat_mul_reference(a, b, &ab)
+	testing.expect(t, a * b == ab)
+}
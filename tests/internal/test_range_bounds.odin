@@ -0,0 +1,74 @@
+package test_internal
+
+import "core:c/libc"
+import "core:testing"
+
+@(private="file")
+range_bounds_sum :: proc(s: []int, str: string) -> (total: int) {
+	for _, i in s {
+		total += s[i]
+	}
+	for i in 0..<len(s) {
+		total += s[i]
+	}
+	for i in 1..<len(s) {
+		total += s[i-1]
+	}
+	#reverse for _, i in str {
+		total += int(str[i])
+	}
+	for i in 0..<len(str) {
+		first := s[:1]
+		total += first[i%len(first)]
+	}
+	return
+}
+
+@(private="file")
+range_bounds_array :: proc() -> (total: int) {
+	a: [8]int
+	for _, i in a {
+		a[i] = i
+	}
+	b: [16]int
+	for _, i in a {
+		b[i] = a[i]
+	}
+	for i in 0..<8 {
+		total += a[i] + b[i] + b[i+8]
+	}
+	return
+}
+
+// NOTE: Neither `other` (a different slice) nor `tail` (reassigned within the loop) is known to be in bounds
+@(private="file")
+range_bounds_checked :: proc(s, other: []int, shrink_at: int) -> (total: int) {
+	tail := s
+	for _, i in s {
+		total += s[i] + other[i]
+		if i == shrink_at {
+			tail = tail[:1]
+		}
+		total += tail[i]
+	}
+	return
+}
+
+@(test)
+test_range_bounds :: proc(t: ^testing.T) {
+	s := []int{1, 2, 3, 4}
+	testing.expect_value(t, range_bounds_sum(s, "ab"), 10 + 10 + 6 + 'a' + 'b' + 2)
+	testing.expect_value(t, range_bounds_sum(nil, ""), 0)
+	testing.expect_value(t, range_bounds_array(), 2*28)
+	testing.expect_value(t, range_bounds_checked(s, s, len(s)), 3*10)
+}
+
+@(test)
+test_range_bounds_trap :: proc(t: ^testing.T) {
+	when ODIN_OS != .Windows && (ODIN_ARCH == .amd64 || ODIN_ARCH == .i386) {
+		// NOTE: The failing index must still reach `runtime.bounds_check_error` through the shared failure block and trap
+		testing.expect_signal(t, libc.SIGILL)
+		s := []int{1, 2, 3, 4}
+		testing.expect_value(t, range_bounds_checked(s, s, 0), -1)
+	}
+}
@@ -0,0 +1,41 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file") Compare_3  :: struct { a: [3]u8 }
+@(private="file") Compare_6  :: struct { a: u32, b: u16 }
+@(private="file") Compare_16 :: struct { a, b: u64 }
+@(private="file") Compare_31 :: struct { a: [31]u8 }
+@(private="file") Compare_64 :: struct { a: [8]u64 }
+@(private="file") Compare_65 :: struct { a: [65]u8 }
+
+@(private="file")
+expect_compare_each_byte :: proc(t: ^testing.T, $T: typeid, loc := #caller_location) {
+	x, y: T
+	testing.expect(t, x == y, loc=loc)
+	testing.expect(t, !(x != y), loc=loc)
+	for i in 0..<size_of(T) {
+		y = x
+		([^]u8)(&y)[i] = 0x80
+		testing.expectf(t, x != y, "byte %d of %v", i, typeid_of(T), loc=loc)
+		testing.expectf(t, !(x == y), "byte %d of %v", i, typeid_of(T), loc=loc)
+
+		m: map[T]int
+		defer delete(m)
+		m[x] = 1
+		m[y] = 2
+		testing.expect_value(t, len(m), 2, loc=loc)
+		testing.expect_value(t, m[y], 2, loc=loc)
+	}
+}
+
+@(test)
+test_record_compare :: proc(t: ^testing.T) {
+	expect_compare_each_byte(t, Compare_3)
+	expect_compare_each_byte(t, Compare_6)
+	expect_compare_each_byte(t, Compare_16)
+	expect_compare_each_byte(t, Compare_31)
+	expect_compare_each_byte(t, Compare_64)
+	expect_compare_each_byte(t, Compare_65)
+	expect_compare_each_byte(t, [5]u16)
+}
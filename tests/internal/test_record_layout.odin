@@ -0,0 +1,86 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+Layout_Leaf :: struct {
+	a: u8,
+	b: f64,
+}
+
+@(private="file")
+Layout_Packed :: struct #packed {
+	a: u8,
+	b: Layout_Leaf,
+}
+
+@(private="file")
+Layout_Raw :: struct #raw_union {
+	a: Layout_Packed,
+	b: [3]u16,
+}
+
+@(private="file")
+Layout_Union :: union {
+	Layout_Leaf,
+	Layout_Raw,
+}
+
+@(private="file")
+Layout_Node :: struct {
+	a: Layout_Union,
+	b: u8,
+	c: [2]Layout_Raw,
+	d: struct {
+		x: u16,
+		y: Layout_Leaf,
+	},
+}
+
+// NOTE: Each level contains the previous two by value, so the layouts must be reused rather than recomputed
+@(private="file") Layout_Deep_0  :: struct { a: Layout_Node, b: Layout_Node }
+@(private="file") Layout_Deep_1  :: struct { a: Layout_Deep_0,  b: Layout_Node,    c: u8 }
+@(private="file") Layout_Deep_2  :: struct { a: Layout_Deep_1,  b: Layout_Deep_0,  c: u8 }
+@(private="file") Layout_Deep_3  :: struct { a: Layout_Deep_2,  b: Layout_Deep_1,  c: u8 }
+@(private="file") Layout_Deep_4  :: struct { a: Layout_Deep_3,  b: Layout_Deep_2,  c: u8 }
+@(private="file") Layout_Deep_5  :: struct { a: Layout_Deep_4,  b: Layout_Deep_3,  c: u8 }
+@(private="file") Layout_Deep_6  :: struct { a: Layout_Deep_5,  b: Layout_Deep_4,  c: u8 }
+@(private="file") Layout_Deep_7  :: struct { a: Layout_Deep_6,  b: Layout_Deep_5,  c: u8 }
+@(private="file") Layout_Deep_8  :: struct { a: Layout_Deep_7,  b: Layout_Deep_6,  c: u8 }
+@(private="file") Layout_Deep_9  :: struct { a: Layout_Deep_8,  b: Layout_Deep_7,  c: u8 }
+@(private="file") Layout_Deep_10 :: struct { a: Layout_Deep_9,  b: Layout_Deep_8,  c: u8 }
+@(private="file") Layout_Deep_11 :: struct { a: Layout_Deep_10, b: Layout_Deep_9,  c: u8 }
+@(private="file") Layout_Deep_12 :: struct { a: Layout_Deep_11, b: Layout_Deep_10, c: u8 }
+@(private="file") Layout_Deep_13 :: struct { a: Layout_Deep_12, b: Layout_Deep_11, c: u8 }
+@(private="file") Layout_Deep_14 :: struct { a: Layout_Deep_13, b: Layout_Deep_12, c: u8 }
+@(private="file") Layout_Deep_15 :: struct { a: Layout_Deep_14, b: Layout_Deep_13, c: u8 }
+@(private="file") Layout_Deep_16 :: struct { a: Layout_Deep_15, b: Layout_Deep_14, c: u8 }
+@(private="file") Layout_Deep_17 :: struct { a: Layout_Deep_16, b: Layout_Deep_15, c: u8 }
+@(private="file") Layout_Deep_18 :: struct { a: Layout_Deep_17, b: Layout_Deep_16, c: u8 }
+@(private="file") Layout_Deep_19 :: struct { a: Layout_Deep_18, b: Layout_Deep_17, c: u8 }
+
+@(test)
+test_record_layout :: proc(t: ^testing.T) {
+	testing.expect_value(t, size_of(Layout_Leaf), 16)
+	testing.expect_value(t, align_of(Layout_Leaf), 8)
+
+	testing.expect_value(t, size_of(Layout_Packed), 17)
+	testing.expect_value(t, align_of(Layout_Packed), 1)
+	testing.expect_value(t, offset_of(Layout_Packed, b), 1)
+
+	testing.expect_value(t, size_of(Layout_Raw), 18)
+	testing.expect_value(t, align_of(Layout_Raw), 2)
+
+	testing.expect_value(t, size_of(Layout_Union), 32)
+	testing.expect_value(t, align_of(Layout_Union), 8)
+
+	testing.expect_value(t, offset_of(Layout_Node, b), 32)
+	testing.expect_value(t, offset_of(Layout_Node, c), 34)
+	testing.expect_value(t, offset_of(Layout_Node, d), 72)
+	testing.expect_value(t, size_of(Layout_Node), 96)
+
+	testing.expect_value(t, size_of(Layout_Deep_0), 2*size_of(Layout_Node))
+	testing.expect_value(t, offset_of(Layout_Deep_19, b), size_of(Layout_Deep_18))
+	testing.expect_value(t, offset_of(Layout_Deep_19, c), size_of(Layout_Deep_18) + size_of(Layout_Deep_17))
+	testing.expect_value(t, align_of(Layout_Deep_19), 8)
+}
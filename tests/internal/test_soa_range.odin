@@ -0,0 +1,73 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+Soa_Particle :: struct {
+	pos, vel: [2]f32,
+	id:       int,
+}
+
+@(private="file")
+soa_step :: proc(ps: #soa[]Soa_Particle, dt: f32) -> (ids: int) {
+	loop: for &p, i in ps {
+		if i >= 8 {
+			break loop
+		}
+		p.pos += p.vel * dt
+		ids += p.id * i
+	}
+	#reverse for p in ps {
+		ids = ids*2 + p.id
+	}
+	return
+}
+
+@(test)
+test_soa_range :: proc(t: ^testing.T) {
+	ps: #soa[dynamic]Soa_Particle
+	defer delete(ps)
+	for i in 0..<5 {
+		append_soa(&ps, Soa_Particle{pos = {f32(i), 0}, vel = {1, 2}, id = i + 1})
+	}
+
+	ids := soa_step(ps[:], 0.5)
+	testing.expect_value(t, ids, (((((0+2+6+12+20)*2 + 5)*2 + 4)*2 + 3)*2 + 2)*2 + 1)
+	for p, i in ps {
+		testing.expect_value(t, p.pos, [2]f32{f32(i) + 0.5, 1})
+	}
+
+	// NOTE: The loop variable's columns must be reloaded for every loop, not just the first
+	sum: int
+	for _ in 0..<2 {
+		for &p in ps {
+			p.id += 1
+			sum += p.id
+		}
+		append_soa(&ps, Soa_Particle{id = 100})
+	}
+	testing.expect_value(t, sum, (2+3+4+5+6) + (3+4+5+6+7+101))
+
+	// NOTE: Appending within the body may move the columns, so they cannot be hoisted out of the loop
+	grown: #soa[dynamic]Soa_Particle
+	defer delete(grown)
+	for i in 0..<4 {
+		append_soa(&grown, Soa_Particle{id = i*10})
+	}
+	sum = 0
+	for &p, i in grown {
+		if i == 0 {
+			for _ in 0..<10000 {
+				append_soa(&grown, Soa_Particle{})
+			}
+		}
+		p.id += 1
+		sum += p.id
+	}
+	testing.expect_value(t, sum, 1 + 11 + 21 + 31)
+	testing.expect_value(t, grown[1].id, 11)
+	testing.expect_value(t, grown[3].id, 31)
+
+	empty: #soa[]Soa_Particle
+	testing.expect_value(t, soa_step(empty, 1), 0)
+}
@@ -0,0 +1,118 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+switch_ranges_signed :: proc(x: i64) -> int {
+	switch x {
+	case min(i64)..<-1000: return 1
+	case -5..=-1:          return 2
+	case 0, 2, 4:          return 3
+	case 7..<9:            return 4
+	case 10..=500:         return 5
+	case 600, 700, 800:    return 6
+	case 1000..=max(i64):  return 7
+	case:                  return 0
+	}
+}
+
+@(private="file")
+switch_ranges_signed_reference :: proc(x: i64) -> int {
+	if x < -1000                    { return 1 }
+	if -5 <= x && x <= -1           { return 2 }
+	if x == 0 || x == 2 || x == 4   { return 3 }
+	if 7 <= x && x < 9              { return 4 }
+	if 10 <= x && x <= 500          { return 5 }
+	if x == 600 || x == 700 || x == 800 { return 6 }
+	if x >= 1000                    { return 7 }
+	return 0
+}
+
+@(private="file")
+switch_ranges_unsigned :: proc(x: u8) -> (res: int) {
+	switch x {
+	case 'a'..='z':
+		res = 1
+	case 'A'..='Z':
+		res = 2
+	case '0'..='9':
+		res = 3
+		fallthrough
+	case 0x80..=0xff:
+		res += 10
+	}
+	return
+}
+
+@(private="file")
+Switch_Op :: enum u16 {
+	Nop, Load, Store, Add = 100, Sub, Jump = 1000, Call, Ret,
+}
+
+@(private="file")
+switch_ranges_enum :: proc(op: Switch_Op) -> int {
+	#partial switch op {
+	case .Nop:         return 1
+	case .Load..=.Store: return 2
+	case .Add..=.Sub:  return 3
+	case .Jump..=.Ret: return 4
+	}
+	return 0
+}
+
+@(private="file")
+Switch_Level :: enum i32 {
+	Lowest = -100_000, Low = -1, Zero = 0, High = 1000, Highest = 100_000,
+}
+
+// NOTE: Wide enough that the enum's ranges become comparisons rather than expanded cases
+@(private="file")
+switch_ranges_signed_enum :: proc(l: Switch_Level) -> int {
+	#partial switch l {
+	case .Lowest..=.Low:    return 1
+	case .Zero:             return 2
+	case .High..<.Highest:  return 3
+	case .Highest:          return 4
+	}
+	return 0
+}
+
+@(test)
+test_switch_ranges :: proc(t: ^testing.T) {
+	for x in i64(-2000)..=2000 {
+		testing.expect_value(t, switch_ranges_signed(x), switch_ranges_signed_reference(x))
+	}
+	for x in ([]i64{min(i64), min(i64)+1, -1001, max(i64), max(i64)-1}) {
+		testing.expect_value(t, switch_ranges_signed(x), switch_ranges_signed_reference(x))
+	}
+
+	for x in 0..=255 {
+		c := u8(x)
+		expected := 0
+		switch {
+		case 'a' <= c && c <= 'z': expected = 1
+		case 'A' <= c && c <= 'Z': expected = 2
+		case '0' <= c && c <= '9': expected = 13
+		case c >= 0x80:            expected = 10
+		}
+		testing.expect_value(t, switch_ranges_unsigned(c), expected)
+	}
+
+	testing.expect_value(t, switch_ranges_enum(.Nop),   1)
+	testing.expect_value(t, switch_ranges_enum(.Store), 2)
+	testing.expect_value(t, switch_ranges_enum(.Sub),   3)
+	testing.expect_value(t, switch_ranges_enum(.Call),  4)
+	testing.expect_value(t, switch_ranges_enum(Switch_Op(50)), 0)
+	testing.expect_value(t, switch_ranges_enum(Switch_Op(103)), 0)
+
+	for x in ([]i32{min(i32), -100_001, -100_000, -5, -1, 0, 1, 999, 1000, 99_999, 100_000, 100_001, max(i32)}) {
+		expected := 0
+		switch {
+		case -100_000 <= x && x <= -1:   expected = 1
+		case x == 0:                     expected = 2
+		case 1000 <= x && x < 100_000:   expected = 3
+		case x == 100_000:               expected = 4
+		}
+		testing.expect_value(t, switch_ranges_signed_enum(Switch_Level(x)), expected)
+	}
+}
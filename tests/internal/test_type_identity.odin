@@ -0,0 +1,44 @@
+package test_internal
+
+import "core:testing"
+
+@(private="file")
+identity_elem :: proc(p: ^$T) -> typeid {
+	return typeid_of(T)
+}
+
+@(private="file")
+identity_count :: proc(a: [$N]$T) -> int {
+	return N
+}
+
+@(private="file")
+identity_matrix :: proc(m: matrix[$R, $C]$T) -> int {
+	return R*C
+}
+
+@(test)
+test_type_identity :: proc(t: ^testing.T) {
+	testing.expect(t, typeid_of(^int) == typeid_of(^int))
+	testing.expect(t, typeid_of([]^int) == typeid_of([]^int))
+	testing.expect(t, typeid_of([dynamic][4]f32) == typeid_of([dynamic][4]f32))
+	testing.expect(t, typeid_of([^]u8) != typeid_of(^u8))
+	testing.expect(t, typeid_of([3]int) != typeid_of([4]int))
+	testing.expect(t, typeid_of(matrix[2, 3]f32) != typeid_of(#row_major matrix[2, 3]f32))
+
+	x := 1
+	y: [2]f32
+	testing.expect(t, identity_elem(&x) == int)
+	testing.expect(t, identity_elem(&y) == [2]f32)
+
+	a := [?]int{1, 2, 3}
+	b := [?]int{1, 2, 3, 4, 5}
+	testing.expect(t, type_of(a) == [3]int)
+	testing.expect(t, type_of(b) == [5]int)
+	testing.expect_value(t, identity_count(a), 3)
+	testing.expect_value(t, identity_count(b), 5)
+	testing.expect_value(t, identity_count([2]f64{}), 2)
+
+	testing.expect_value(t, identity_matrix(matrix[2, 3]f32{}), 6)
+	testing.expect_value(t, identity_matrix(matrix[4, 4]f32{}), 16)
+}
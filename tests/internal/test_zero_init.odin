@@ -0,0 +1,156 @@
+package test_internal
+
+import "base:runtime"
+import "core:testing"
+
+// NOTE: Leaves non-zero bytes where the next call's locals will live, so a wrongly elided zeroing shows up
+@(private="file")
+dirty_stack :: proc "contextless" () -> (total: int) {
+	junk: [256]int = ---
+	for &x, i in junk {
+		x = 0x5a5a_5a5a + i
+		total += x
+	}
+	return
+}
+
+@(private="file")
+zero_init_cases :: proc(src: [32]int, c: bool) -> (total: int) {
+	full: [32]int
+	full = src
+	total += full[31]
+
+	nested: [32]int
+	if c {
+		nested = src
+	}
+	total += nested[31]
+
+	partial: [32]int
+	partial[0] = 1
+	partial = partial
+	total += partial[31]
+
+	deferred: [32]int
+	{
+		defer deferred = src
+		total += deferred[31]
+	}
+
+	self: [32]int
+	self = {0 = self[31]}
+	total += self[0]
+
+	a, b: [32]int
+	a, b = src, a
+	total += b[31]
+	return
+}
+
+@(private="file")
+zero_init_branches :: proc(src: [32]int, n: int) -> (total: int) {
+	both: [32]int
+	if n == 0 {
+		both = src
+	} else {
+		both = {31 = 1}
+	}
+	total += both[31]
+
+	cases: [32]int
+	switch n {
+	case 0:
+		cases = src
+	case 1:
+		cases = {}
+		fallthrough
+	case:
+		cases[31] += 1
+	}
+	total += cases[31]
+
+	no_default: [32]int
+	switch n {
+	case 0: no_default = src
+	case 1: no_default = src
+	}
+	total += no_default[31]
+
+	broken: [32]int
+	switch n {
+	case 0:
+		if src[31] != 0 {
+			break
+		}
+		broken = src
+	case:
+		broken = src
+	}
+	total += broken[31]
+
+	labelled: [32]int
+	block: {
+		if n == 0 {
+			break block
+		}
+		labelled = src
+	}
+	total += labelled[31]
+
+	returned: [32]int
+	if n > 2 {
+		return -1
+	} else {
+		returned = src
+	}
+	total += returned[31]
+	return
+}
+
+@(private="file")
+zero_init_copies :: proc(src: []int, bytes: ^[32]int) -> (total: int) {
+	whole: [32]int
+	copy(whole[:], src[:32])
+	total += whole[31]
+
+	short: [32]int
+	copy(short[:], src[1:])
+	total += short[31]
+
+	raw: [32]int
+	runtime.mem_copy(&raw, bytes, size_of(raw))
+	total += raw[31]
+
+	half: [32]int
+	runtime.mem_copy(&half, bytes, size_of(half)/2)
+	total += half[31]
+	return
+}
+
+@(test)
+test_zero_init :: proc(t: ^testing.T) {
+	src: [32]int
+	src[31] = 7
+
+	_ = dirty_stack()
+	testing.expect_value(t, zero_init_cases(src, false), 7)
+	_ = dirty_stack()
+	testing.expect_value(t, zero_init_cases(src, true), 14)
+
+	for n in 0..<3 {
+		_ = dirty_stack()
+		// NOTE: `both`, `cases`, `no_default`, `broken`, `labelled` and `returned`
+		expected := [3]int{7+7+7+0+0+7, 1+1+7+7+7+7, 1+1+0+7+7+7}
+		testing.expect_value(t, zero_init_branches(src, n), expected[n])
+	}
+	_ = dirty_stack()
+	testing.expect_value(t, zero_init_branches(src, 3), -1)
+
+	long: [40]int
+	long[31] = 3
+	long[32] = 5
+	_ = dirty_stack()
+	testing.expect_value(t, zero_init_copies(long[:], &src), 3 + 5 + 7 + 0)
+	_ = dirty_stack()
+	testing.expect_value(t, zero_init_copies(long[:32], &src), 3 + 0 + 7 + 0)
+}
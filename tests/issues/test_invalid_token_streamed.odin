@@ -0,0 +1,8 @@
+// Ensures that an invalid token is reported the same way whether or not the
+// file's tokens are streamed (-internal-stream-tokens)
+package test_issues
+
+main :: proc() {
+	x := 1
+	y :=  x
+}